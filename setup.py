@@ -35,13 +35,23 @@ def yaposib_extension():
             "Vol": "osi-vol",
             "Xpr": "osi-xpress"
             }
+    # libraries of the compressed model files
+    compressions = {
+            "Zlib": "zlib",
+            "Bzip2": "bzip2",
+            "Zstd": "libzstd"
+            }
     kw = {
             # python2.7 wants PY_FORMAT_LONG_LONG to be defined
             "define_macros": [("PY_FORMAT_LONG_LONG", "I64")],
             "include_dirs": [],
             "library_dirs": [],
             # TODO: find a way to detect boost_python
-            "libraries": [ "boost_python" ]
+            "libraries": [ "boost_python" ],
+            # the subproblems of Benders are solved by OpenMP threads, and
+            # the native readers parse with them
+            "extra_compile_args": [ "-fopenmp" ],
+            "extra_link_args": [ "-fopenmp" ]
             }
 
     # Required stuff. We fail if we miss that.
@@ -55,7 +65,7 @@ def yaposib_extension():
             sys.exit(1)
 
     # Optional stuff.
-    for solvername, lib in solvers.items():
+    for solvername, lib in list(solvers.items()) + list(compressions.items()):
         try:
             pc = pkgconfig(lib)
             kw["include_dirs"] += pc.get("include_dirs", [])
@@ -66,10 +76,24 @@ def yaposib_extension():
             pass
 
     files = [ "CArrays.cpp",
+              "BatchSolver.cpp",
+              "Benders.cpp",
+              "Callbacks.cpp",
               "Col.cpp",
+              "Compression.cpp",
+              "Fingerprint.cpp",
+              "LpReader.cpp",
+              "MappedFile.cpp",
+              "Model.cpp",
+              "ModelWriter.cpp",
+              "MpsReader.cpp",
               "Row.cpp",
               "Obj.cpp",
               "Problem.cpp",
+              "Snapshot.cpp",
+              "SolutionCache.cpp",
+              "SolutionFile.cpp",
+              "SolverPool.cpp",
               "Binding.cpp",
             ]
     sources = [join('src/yaposib', f) for f in files]
@@ -0,0 +1,383 @@
+#include "BatchSolver.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+#include "Compression.hpp"
+#include "Problem.hpp"
+#include "SolutionFile.hpp"
+
+// OSI includes
+#include <coin/OsiSolverInterface.hpp>
+#include <coin/CoinTime.hpp>
+
+// std includes
+#include <stdexcept>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <map>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// A model file, parsed
+struct BatchInstance
+{
+    // in the list of files (-1: none)
+    int index;
+
+    ModelData model;
+
+    double readTime;
+
+    std::string error;
+};
+
+struct BatchResult
+{
+    std::string file;
+
+    std::string status;
+
+    // only for the optimal instances
+    bool hasObjective;
+
+    double objective;
+
+    double time;
+
+    double readTime;
+
+    int iterations;
+
+    int nodes;
+
+    std::string solution;
+
+    std::string error;
+
+    BatchResult() :
+        hasObjective(false), objective(0), time(0), readTime(0),
+        iterations(0), nodes(-1) {}
+};
+
+static bool endsWith(const std::string &name, const std::string &suffix)
+{
+    return name.size() >= suffix.size()
+        && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// The file name without its directory, its compression extension and its
+// model extension
+static std::string stem(std::string filename, bool &lp)
+{
+    std::size_t slash = filename.rfind('/');
+    if (slash != std::string::npos)
+    {
+        filename = filename.substr(slash + 1);
+    }
+    std::string format = Compression::formatOf(filename);
+    if (!format.empty())
+    {
+        filename = filename.substr(0, filename.rfind('.'));
+    }
+    lp = endsWith(filename, ".lp");
+    std::size_t dot = filename.rfind('.');
+    return (dot == std::string::npos || dot == 0)
+        ? filename : filename.substr(0, dot);
+}
+
+static void readInstance(const std::vector< std::string > &filenames,
+        BatchInstance &instance)
+{
+    instance.model = ModelData();
+    instance.error.clear();
+    instance.readTime = 0;
+    if (instance.index < 0)
+    {
+        return;
+    }
+    double start = CoinWallclockTime();
+    try
+    {
+        bool lp;
+        stem(filenames[instance.index], lp);
+        // the workers already read in parallel
+        Problem::parseModelFile(filenames[instance.index], lp, 1,
+                instance.model);
+    }
+    catch (std::exception &e)
+    {
+        instance.error = e.what();
+    }
+    catch (...)
+    {
+        instance.error = "unknown error";
+    }
+    instance.readTime = CoinWallclockTime() - start;
+}
+
+static std::string integer(int value)
+{
+    char buffer[16];
+    std::sprintf(buffer, "%d", value);
+    return buffer;
+}
+
+// The solution file of each model file: <name>.npy, or <name>.<index>.npy
+// if several files share the same name (in different directories, or
+// with different extensions)
+static std::vector< std::string > solutionFiles(
+        const std::vector< std::string > &filenames, std::string solutionDir)
+{
+    std::vector< std::string > stems;
+    std::map< std::string, int > counts;
+    for (std::size_t k = 0; k < filenames.size(); ++k)
+    {
+        bool lp;
+        stems.push_back(stem(filenames[k], lp));
+        ++counts[stems.back()];
+    }
+    std::vector< std::string > res;
+    for (std::size_t k = 0; k < filenames.size(); ++k)
+    {
+        std::string name = solutionDir + "/" + stems[k];
+        if (counts[stems[k]] > 1)
+        {
+            name += "." + integer(k);
+        }
+        res.push_back(name + ".npy");
+    }
+    return res;
+}
+
+static void solveInstance(std::string solverName, bool considerMIP,
+        std::string solutionFile, BatchInstance &instance, BatchResult &result)
+{
+    result.readTime = instance.readTime;
+    result.error = instance.error;
+    if (!result.error.empty())
+    {
+        result.status = "abandoned";
+        return;
+    }
+    try
+    {
+        Problem problem(solverName);
+        problem.loadModel(instance.model);
+        // the solver has its own copy
+        instance.model = ModelData();
+        problem.solve(considerMIP && SolverPool::supportsMip(solverName));
+        const SolveStats &stats = problem.getStats();
+        result.status = problem.getSolverStatus();
+        result.time = stats.lpWallTime + stats.mipWallTime;
+        result.iterations = stats.lpIterations + stats.mipIterations;
+        result.nodes = stats.nodes;
+        if (result.status == "optimal")
+        {
+            result.hasObjective = true;
+            result.objective = problem.getObjValue();
+            if (!solutionFile.empty())
+            {
+                result.solution = solutionFile;
+                SolutionFile::writeNpy(result.solution,
+                        problem.getSolverInterface()->getColSolution(),
+                        problem.getNumCols());
+            }
+        }
+    }
+    catch (std::exception &e)
+    {
+        result.status = "abandoned";
+        result.error = e.what();
+    }
+    catch (...)
+    {
+        result.status = "abandoned";
+        result.error = "unknown error";
+    }
+}
+
+static std::string jsonString(const std::string &value)
+{
+    std::string res = "\"";
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        unsigned char c = value[i];
+        if (c == '"' || c == '\\')
+        {
+            res += '\\';
+            res += c;
+        }
+        else if (c < 0x20)
+        {
+            char buffer[8];
+            std::sprintf(buffer, "\\u%04x", c);
+            res += buffer;
+        }
+        else
+        {
+            res += c;
+        }
+    }
+    return res + "\"";
+}
+
+static std::string number(double value, const char * format)
+{
+    char buffer[32];
+    std::sprintf(buffer, format, value);
+    return buffer;
+}
+
+
+static std::string formatResult(const BatchResult &result, bool csv)
+{
+    std::string objective = result.hasObjective
+        ? number(result.objective, "%.17g") : "";
+    std::string time = number(result.time, "%.6f");
+    std::string readTime = number(result.readTime, "%.6f");
+    std::string iterations = integer(result.iterations);
+    std::string nodes = integer(result.nodes);
+    if (csv)
+    {
+        return SolutionFile::csvField(result.file) + "," + result.status + ","
+            + objective + "," + time + "," + readTime + "," + iterations
+            + "," + nodes + "," + SolutionFile::csvField(result.solution) + ","
+            + SolutionFile::csvField(result.error) + "\n";
+    }
+    return "{\"file\": " + jsonString(result.file)
+        + ", \"status\": " + jsonString(result.status)
+        + ", \"objective\": " + (objective.empty() ? "null" : objective)
+        + ", \"time\": " + time
+        + ", \"readTime\": " + readTime
+        + ", \"iterations\": " + iterations
+        + ", \"nodes\": " + nodes
+        + ", \"solution\": " + jsonString(result.solution)
+        + ", \"error\": " + jsonString(result.error) + "}\n";
+}
+
+BatchSolver::BatchSolver(std::string solverName) :
+    _solverName(solverName),
+    _numThreads(0),
+    _considerMIP(true)
+{
+    if (!SolverPool::isAvailable(solverName))
+    {
+        throw std::runtime_error(solverName + ": Unknown _solver");
+    }
+}
+
+int BatchSolver::getNumThreads() const
+{
+    return _numThreads;
+}
+
+void BatchSolver::setNumThreads(int numThreads)
+{
+    if (numThreads < 0)
+    {
+        throw std::runtime_error("The number of threads can not be negative");
+    }
+    _numThreads = numThreads;
+}
+
+bool BatchSolver::getConsiderMIP() const
+{
+    return _considerMIP;
+}
+
+void BatchSolver::setConsiderMIP(bool considerMIP)
+{
+    _considerMIP = considerMIP;
+}
+
+std::string BatchSolver::getSolutionDir() const
+{
+    return _solutionDir;
+}
+
+void BatchSolver::setSolutionDir(std::string solutionDir)
+{
+    _solutionDir = solutionDir;
+}
+
+int BatchSolver::solve(const std::vector< std::string > &filenames,
+        std::string resultsFile)
+{
+    bool csv = endsWith(resultsFile, ".csv");
+    bool toStdout = (resultsFile == "-");
+    std::FILE * out = toStdout ? stdout : std::fopen(resultsFile.c_str(), "w");
+    if (out == NULL)
+    {
+        throw std::runtime_error("Can not open " + resultsFile + ": "
+                + std::strerror(errno));
+    }
+    if (csv)
+    {
+        std::fputs("file,status,objective,time,readTime,iterations,nodes,"
+                "solution,error\n", out);
+    }
+
+    std::vector< std::string > solutions(filenames.size());
+    if (!_solutionDir.empty())
+    {
+        solutions = solutionFiles(filenames, _solutionDir);
+    }
+    int numFiles = filenames.size();
+    int nextFile = 0;
+    int numOptimal = 0;
+#ifdef _OPENMP
+    int numThreads = (_numThreads > 0) ? _numThreads : omp_get_max_threads();
+    // each worker reads its next file in a nested thread
+    int maxActiveLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(2);
+#endif
+    #pragma omp parallel num_threads(numThreads)
+    {
+        // the current instance and the next one, in turn
+        BatchInstance instances[2];
+        int current = 0;
+        #pragma omp critical(batchFiles)
+        instances[current].index = (nextFile < numFiles) ? nextFile++ : -1;
+        readInstance(filenames, instances[current]);
+        while (instances[current].index >= 0)
+        {
+            BatchInstance &instance = instances[current];
+            BatchInstance &following = instances[1 - current];
+            #pragma omp critical(batchFiles)
+            following.index = (nextFile < numFiles) ? nextFile++ : -1;
+            BatchResult result;
+            result.file = filenames[instance.index];
+            #pragma omp parallel sections num_threads(2)
+            {
+                #pragma omp section
+                solveInstance(_solverName, _considerMIP,
+                        solutions[instance.index], instance, result);
+                #pragma omp section
+                readInstance(filenames, following);
+            }
+            std::string line = formatResult(result, csv);
+            #pragma omp critical(batchResults)
+            {
+                std::fputs(line.c_str(), out);
+                std::fflush(out);
+                if (result.status == "optimal")
+                {
+                    ++numOptimal;
+                }
+            }
+            current = 1 - current;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_max_active_levels(maxActiveLevels);
+#endif
+    if (!toStdout && std::fclose(out) != 0)
+    {
+        throw std::runtime_error("Can not write " + resultsFile);
+    }
+    return numOptimal;
+}
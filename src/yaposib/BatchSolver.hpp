@@ -0,0 +1,62 @@
+#ifndef BATCHSOLVER_HPP
+#define BATCHSOLVER_HPP
+
+/// @file:          BatchSolver.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+
+// Solves a set of model files (mps, or lp if the name ends with ".lp",
+// optionally compressed), independently of each other.
+//
+// numThreads workers take the files in turn. Each of them reads and
+// parses its next file while it solves the current one, so that the
+// solves do not wait for the disk. A result line is written as soon as
+// an instance is finished (in the order they finish): file, status,
+// objective, solve time, read time, iterations, nodes, solution file and
+// error, as JSON lines, or as CSV if the results file ends with ".csv".
+class BatchSolver
+{
+    private:
+        std::string _solverName;
+
+        int _numThreads;
+
+        bool _considerMIP;
+
+        // Directory of the solution vectors ("": not written)
+        std::string _solutionDir;
+
+    public:
+        BatchSolver(std::string solverName);
+
+        // Number of workers (0: as many as OpenMP wants)
+        int getNumThreads() const;
+
+        void setNumThreads(int numThreads);
+
+        // Are the integer variables considered (if the solver can)?
+        bool getConsiderMIP() const;
+
+        void setConsiderMIP(bool considerMIP);
+
+        // If it is not empty, the column solution of every solved
+        // instance is written in this directory, as <name>.npy (the name
+        // of the file without its directory and extensions), or as
+        // <name>.<index in the list>.npy when several files have the
+        // same name
+        std::string getSolutionDir() const;
+
+        void setSolutionDir(std::string solutionDir);
+
+        // Solves the files and writes their results in resultsFile ("-"
+        // for the standard output). Returns the number of instances
+        // solved to optimality. Errors of an instance are reported in
+        // its result line, only an unwritable results file throws.
+        int solve(const std::vector< std::string > &filenames,
+                std::string resultsFile);
+};
+
+#endif /* BATCHSOLVER_HPP*/
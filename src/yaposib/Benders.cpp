@@ -0,0 +1,437 @@
+#include "Benders.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+#include "Problem.hpp"
+
+// OSI includes
+#include <coin/OsiSolverInterface.hpp>
+#include <coin/CoinPackedMatrix.hpp>
+
+// std includes
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+Benders::Benders(Problem * master) :
+    _master(master),
+    _lowerBound(0),
+    _upperBound(0),
+    _iterations(0),
+    _numThreads(0)
+{}
+
+void Benders::addSubproblem(Problem * problem, int theta, const Indices &rows,
+        const Indices &starts, const Indices &cols, const Values &values)
+{
+    if (theta < 0 || theta >= _master->getNumCols())
+    {
+        throw std::runtime_error("Index out of range, theta is not a master column");
+    }
+    if (problem->getMaximize() || _master->getMaximize())
+    {
+        throw std::runtime_error("Benders expects minimization problems");
+    }
+    if (starts.size() != rows.size() + 1 || cols.size() != values.size()
+            || starts[0] != 0 || starts.back() != (int)cols.size())
+    {
+        throw std::runtime_error("Malformed sparse vectors");
+    }
+    // the subproblems are solved in parallel, each needs its own solver
+    // (copies of a Problem share the solver of the original)
+    OsiSolverInterface * solver = problem->getSolverInterface();
+    bool shared = (solver == _master->getSolverInterface());
+    for (std::size_t s = 0; s < _subproblems.size(); ++s)
+    {
+        shared = shared
+            || solver == _subproblems[s].problem->getSolverInterface();
+    }
+    if (shared)
+    {
+        throw std::runtime_error("The subproblem shares its solver with the "
+                "master or another subproblem");
+    }
+    Subproblem sub;
+    sub.problem = problem;
+    sub.theta = theta;
+    sub.rows = rows;
+    sub.technology.starts = starts;
+    sub.technology.indices = cols;
+    sub.technology.values = values;
+    for (std::size_t k = 0; k < rows.size(); ++k)
+    {
+        sub.technology.lower.push_back(problem->getRowLower(rows[k]));
+        sub.technology.upper.push_back(problem->getRowUpper(rows[k]));
+    }
+    for (std::size_t i = 0; i < cols.size(); ++i)
+    {
+        if (cols[i] < 0 || cols[i] >= _master->getNumCols())
+        {
+            throw std::runtime_error("Index out of range, add more master columns");
+        }
+    }
+    _subproblems.push_back(sub);
+}
+
+int Benders::size() const
+{
+    return _subproblems.size();
+}
+
+void Benders::solveSubproblem(const Subproblem &sub, const Values &x,
+        Result &result) const
+{
+    Problem * problem = sub.problem;
+    double infinity = problem->getInfinity();
+    const SparseBatch &t = sub.technology;
+    for (std::size_t k = 0; k < sub.rows.size(); ++k)
+    {
+        double shift = 0;
+        for (int i = t.starts[k]; i < t.starts[k+1]; ++i)
+        {
+            shift += t.values[i] * x[t.indices[i]];
+        }
+        if (t.lower[k] > -infinity)
+        {
+            problem->setRowLower(sub.rows[k], t.lower[k] - shift);
+        }
+        if (t.upper[k] < infinity)
+        {
+            problem->setRowUpper(sub.rows[k], t.upper[k] - shift);
+        }
+    }
+    problem->solve(false);
+    result.status = problem->getSolverStatus();
+    if (problem->isProvenPrimalInfeasible())
+    {
+        result.status = "infeasible";
+        feasibilityCut(sub, x, result);
+        return;
+    }
+    if (result.status != "optimal")
+    {
+        result.status = "abandoned";
+        return;
+    }
+    // Q(x) >= Q(x*) + g^T (x - x*) with g = -T^T duals
+    const double * duals = problem->getSolverInterface()->getRowPrice();
+    result.objective = problem->getObjValue();
+    result.coefficients.assign(x.size(), 0);
+    for (std::size_t k = 0; k < sub.rows.size(); ++k)
+    {
+        for (int i = t.starts[k]; i < t.starts[k+1]; ++i)
+        {
+            result.coefficients[t.indices[i]] -= duals[sub.rows[k]] * t.values[i];
+        }
+    }
+    // theta - g^T x >= Q(x*) - g^T x*
+    result.lower = result.objective;
+    for (std::size_t j = 0; j < x.size(); ++j)
+    {
+        result.coefficients[j] = - result.coefficients[j];
+        result.lower += result.coefficients[j] * x[j];
+    }
+    result.upper = infinity;
+}
+
+void Benders::feasibilityCut(const Subproblem &sub, const Values &x,
+        Result &result) const
+{
+    // For a dual ray r, every feasible y verifies
+    //    min(r^T [L, U]) <= r^T A y <= max(r^T [L, U])
+    // and r^T A y is within the bounds given by the column bounds. The
+    // subproblem is infeasible because one of these intervals is empty.
+    // The linking rows make the row interval depend on x: the cut asks
+    // for the broken inequality to hold again.
+    OsiSolverInterface * solver = sub.problem->getSolverInterface();
+    std::vector<double *> rays = solver->getDualRays(1);
+    if (rays.empty())
+    {
+        result.status = "abandoned";
+        return;
+    }
+    int numRows = solver->getNumRows();
+    int numCols = solver->getNumCols();
+    double infinity = solver->getInfinity();
+    Values ray(rays[0], rays[0] + numRows);
+    for (std::size_t i = 0; i < rays.size(); ++i)
+    {
+        delete[] rays[i];
+    }
+    // bounds of r^T A y given by the column bounds
+    Values rho(numCols, 0);
+    solver->getMatrixByCol()->transposeTimes(&ray[0], &rho[0]);
+    const double * colLower = solver->getColLower();
+    const double * colUpper = solver->getColUpper();
+    double colMin = 0;
+    double colMax = 0;
+    for (int j = 0; j < numCols; ++j)
+    {
+        if (rho[j] > 0)
+        {
+            colMin += (colLower[j] > -infinity) ? rho[j] * colLower[j] : -infinity;
+            colMax += (colUpper[j] < infinity) ? rho[j] * colUpper[j] : infinity;
+        }
+        else if (rho[j] < 0)
+        {
+            colMin += (colUpper[j] < infinity) ? rho[j] * colUpper[j] : -infinity;
+            colMax += (colLower[j] > -infinity) ? rho[j] * colLower[j] : infinity;
+        }
+    }
+    // bounds of r^T A y given by the row bounds, as constant + slope^T x
+    std::map<int, int> linking;
+    for (std::size_t k = 0; k < sub.rows.size(); ++k)
+    {
+        linking[sub.rows[k]] = k;
+    }
+    const double * rowLower = solver->getRowLower();
+    const double * rowUpper = solver->getRowUpper();
+    const SparseBatch &t = sub.technology;
+    double minConstant = 0;
+    double maxConstant = 0;
+    Values slope(x.size(), 0);
+    for (int i = 0; i < numRows; ++i)
+    {
+        if (ray[i] == 0)
+        {
+            continue;
+        }
+        std::map<int, int>::const_iterator it = linking.find(i);
+        // bounds for x = 0
+        double lower = (it == linking.end()) ? rowLower[i] : t.lower[it->second];
+        double upper = (it == linking.end()) ? rowUpper[i] : t.upper[it->second];
+        double forMin = (ray[i] > 0) ? lower : upper;
+        double forMax = (ray[i] > 0) ? upper : lower;
+        minConstant += (std::fabs(forMin) < infinity) ? ray[i] * forMin : -infinity;
+        maxConstant += (std::fabs(forMax) < infinity) ? ray[i] * forMax : infinity;
+        if (it != linking.end())
+        {
+            int k = it->second;
+            for (int e = t.starts[k]; e < t.starts[k+1]; ++e)
+            {
+                slope[t.indices[e]] -= ray[i] * t.values[e];
+            }
+        }
+    }
+    double slopeAtX = 0;
+    for (std::size_t j = 0; j < x.size(); ++j)
+    {
+        slopeAtX += slope[j] * x[j];
+    }
+    double tol = 1e-7;
+    result.coefficients = slope;
+    if (minConstant > -infinity && colMax < infinity
+            && minConstant + slopeAtX > colMax + tol)
+    {
+        // slope^T x <= colMax - minConstant
+        result.lower = -infinity;
+        result.upper = colMax - minConstant;
+    }
+    else if (maxConstant < infinity && colMin > -infinity
+            && maxConstant + slopeAtX < colMin - tol)
+    {
+        // slope^T x >= colMin - maxConstant
+        result.lower = colMin - maxConstant;
+        result.upper = infinity;
+    }
+    else
+    {
+        // the ray does not separate the master solution
+        result.status = "abandoned";
+    }
+}
+
+std::string Benders::solve(int maxIterations, double tol)
+{
+    double infinity = _master->getInfinity();
+    _lowerBound = -infinity;
+    _upperBound = infinity;
+    _iterations = 0;
+    std::vector< Result > results(_subproblems.size());
+    std::string status = "limitreached";
+    while (_iterations < maxIterations)
+    {
+        ++_iterations;
+        _master->solve(false);
+        if (_master->isProvenPrimalInfeasible())
+        {
+            status = "infeasible";
+            break;
+        }
+        if (!_master->isProvenOptimal())
+        {
+            status = "abandoned";
+            break;
+        }
+        int numCols = _master->getNumCols();
+        const double * solution = _master->getSolverInterface()->getColSolution();
+        Values x(solution, solution + numCols);
+        _lowerBound = _master->getObjValue();
+
+        int numSubproblems = _subproblems.size();
+#ifdef _OPENMP
+        int numThreads = (_numThreads > 0) ? _numThreads : omp_get_max_threads();
+#endif
+        #pragma omp parallel for schedule(dynamic) num_threads(numThreads)
+        for (int s = 0; s < numSubproblems; ++s)
+        {
+            results[s] = Result();
+            try
+            {
+                solveSubproblem(_subproblems[s], x, results[s]);
+            }
+            catch (std::exception &e)
+            {
+                results[s].status = "abandoned";
+                results[s].error = e.what();
+            }
+            catch (...)
+            {
+                results[s].status = "abandoned";
+                results[s].error = "unknown error";
+            }
+        }
+
+        // optimality cuts are summed by theta, feasibility cuts are kept
+        // as they are
+        SparseBatch cuts;
+        std::map<int, Values> thetaCoefficients;
+        std::map<int, double> thetaLower;
+        bool feasible = true;
+        for (int s = 0; s < numSubproblems; ++s)
+        {
+            Result &result = results[s];
+            if (!result.error.empty())
+            {
+                throw std::runtime_error("Benders subproblem: " + result.error);
+            }
+            if (result.status == "abandoned")
+            {
+                return "abandoned";
+            }
+            if (result.status == "infeasible")
+            {
+                feasible = false;
+                SparseBatch cut;
+                cut.starts.push_back(0);
+                for (int j = 0; j < numCols; ++j)
+                {
+                    if (result.coefficients[j] != 0)
+                    {
+                        cut.indices.push_back(j);
+                        cut.values.push_back(result.coefficients[j]);
+                    }
+                }
+                cut.starts.push_back(cut.indices.size());
+                cut.lower.push_back(result.lower);
+                cut.upper.push_back(result.upper);
+                cuts.append(cut, 0);
+                continue;
+            }
+            int theta = _subproblems[s].theta;
+            Values &coefficients = thetaCoefficients[theta];
+            coefficients.resize(numCols, 0);
+            for (int j = 0; j < numCols; ++j)
+            {
+                coefficients[j] += result.coefficients[j];
+            }
+            thetaLower[theta] += result.lower;
+        }
+
+        if (feasible)
+        {
+            // cost of the current first stage
+            const double * objective = _master->getSolverInterface()->getObjCoefficients();
+            double candidate = _lowerBound;
+            std::map<int, double> thetaCost;
+            for (int s = 0; s < numSubproblems; ++s)
+            {
+                thetaCost[_subproblems[s].theta] += results[s].objective;
+            }
+            std::map<int, double>::iterator it;
+            for (it = thetaCost.begin(); it != thetaCost.end(); ++it)
+            {
+                candidate += objective[it->first] * (it->second - x[it->first]);
+            }
+            _upperBound = std::min(_upperBound, candidate);
+
+            // one optimality cut per theta, if violated
+            std::map<int, Values>::iterator group;
+            for (group = thetaCoefficients.begin();
+                    group != thetaCoefficients.end(); ++group)
+            {
+                int theta = group->first;
+                Values &coefficients = group->second;
+                coefficients[theta] += 1;
+                double activity = 0;
+                SparseBatch row;
+                row.starts.push_back(0);
+                for (int j = 0; j < numCols; ++j)
+                {
+                    if (coefficients[j] != 0)
+                    {
+                        activity += coefficients[j] * x[j];
+                        row.indices.push_back(j);
+                        row.values.push_back(coefficients[j]);
+                    }
+                }
+                row.starts.push_back(row.indices.size());
+                row.lower.push_back(thetaLower[theta]);
+                row.upper.push_back(infinity);
+                if (activity < thetaLower[theta]
+                        - tol * std::max(1.0, std::fabs(thetaLower[theta])))
+                {
+                    cuts.append(row, 0);
+                }
+            }
+            if (_upperBound - _lowerBound
+                    <= tol * std::max(1.0, std::fabs(_upperBound)))
+            {
+                status = "optimal";
+                break;
+            }
+        }
+        if (cuts.size() == 0)
+        {
+            status = "optimal";
+            break;
+        }
+        _master->addRows(cuts);
+    }
+    return status;
+}
+
+double Benders::getLowerBound() const
+{
+    return _lowerBound;
+}
+
+double Benders::getUpperBound() const
+{
+    return _upperBound;
+}
+
+int Benders::getIterations() const
+{
+    return _iterations;
+}
+
+int Benders::getNumThreads() const
+{
+    return _numThreads;
+}
+
+void Benders::setNumThreads(int numThreads)
+{
+    if (numThreads < 0)
+    {
+        throw std::runtime_error("The number of threads can not be negative");
+    }
+    _numThreads = numThreads;
+}
@@ -0,0 +1,127 @@
+#ifndef BENDERS_HPP
+#define BENDERS_HPP
+
+/// @file:          Benders.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include "CArrays.hpp"
+#include "Callbacks.hpp"
+
+class Problem;
+
+// Benders decomposition of a two-stage problem.
+//
+// The master problem (minimization) holds the first stage variables x
+// and, for each group of subproblems, a column theta approximating their
+// cost. A subproblem (minimization) depends on x through some of its
+// rows, whose bounds are shifted by -T x: a row bounded by [l, u] when
+// x = 0 is bounded by [l - T x, u - T x].
+//
+// Each iteration solves the master, updates and solves the subproblems
+// in parallel, and adds to the master at once an optimality cut per
+// theta (the sum of the cuts of the subproblems sharing it) and a
+// feasibility cut per infeasible subproblem.
+class Benders
+{
+    private:
+        // A subproblem and the way it depends on the master
+        struct Subproblem
+        {
+            Problem * problem;
+
+            // Master column approximating the cost of the subproblem
+            int theta;
+
+            // Rows of the subproblem depending on x
+            Indices rows;
+
+            // Row k of T (over the master columns) and the bounds of the
+            // row rows[k] when x = 0
+            SparseBatch technology;
+        };
+
+        // What the solve of a subproblem gives back to the master
+        struct Result
+        {
+            // "optimal", "infeasible" (a feasibility cut was built) or
+            // "abandoned" (no cut could be built)
+            std::string status;
+
+            double objective;
+
+            // cut: lower <= coefficients^T x <= upper (dense over the
+            // master columns). For an optimality cut, theta is omitted.
+            Values coefficients;
+
+            double lower;
+
+            double upper;
+
+            // message of the exception the solve threw, if any
+            std::string error;
+        };
+
+        Problem * _master;
+
+        std::vector< Subproblem > _subproblems;
+
+        double _lowerBound;
+
+        double _upperBound;
+
+        int _iterations;
+
+        int _numThreads;
+
+        // Updates the bounds of the subproblem, solves it and builds its
+        // cut. Runs in parallel, must not touch the master.
+        void solveSubproblem(const Subproblem &sub, const Values &x,
+                Result &result) const;
+
+        // Builds a feasibility cut from a dual ray of the subproblem
+        void feasibilityCut(const Subproblem &sub, const Values &x,
+                Result &result) const;
+
+    public:
+        Benders(Problem * master);
+
+        // Adds a subproblem. rows are its rows depending on x, and the
+        // row k of T is made of the entries starts[k] to starts[k+1] of
+        // cols and values. The bounds of the rows are read now, and are
+        // understood as their bounds for x = 0. Each subproblem must have
+        // its own solver: the same Problem (or a copy of it) can not be
+        // added twice, nor be the master.
+        void addSubproblem(Problem * problem, int theta, const Indices &rows,
+                const Indices &starts, const Indices &cols,
+                const Values &values);
+
+        // Number of subproblems
+        int size() const;
+
+        // Iterates until the gap between the bounds is under tol
+        // (relative), no cut is violated or maxIterations iterations
+        // were made. Returns "optimal", "limitreached", "infeasible" (the
+        // master is) or "abandoned" (a solve failed, or no cut could be
+        // built for an infeasible subproblem).
+        std::string solve(int maxIterations, double tol);
+
+        // Best lower bound (objective of the master)
+        double getLowerBound() const;
+
+        // Best upper bound (cost of the best first stage found)
+        double getUpperBound() const;
+
+        // Number of iterations of the last solve
+        int getIterations() const;
+
+        // Number of threads solving the subproblems (0: as many as
+        // OpenMP wants)
+        int getNumThreads() const;
+
+        void setNumThreads(int numThreads);
+};
+
+#endif /* BENDERS_HPP*/
@@ -2,17 +2,694 @@
 
 #include "Problem.hpp"
 #include "CArrays.hpp"
+#include "Callbacks.hpp"
+#include "SolverPool.hpp"
+#include "BatchSolver.hpp"
+#include "Benders.hpp"
+#include "Compression.hpp"
+#include "Model.hpp"
 #include "Row.hpp"
 #include "Obj.hpp"
 
 #include <coin/CoinPackedVector.hpp>
 #include <boost/python.hpp>
+#include <boost/cstdint.hpp>
+#include <climits>
 using namespace boost::python;
 
+// Read-only view on n doubles owned by the solver, without copy. The
+// python 3 version is a memoryview of format 'd', the python 2 version
+// an old-style buffer (use numpy.frombuffer or struct to read it).
+static object doubleView(const double *data, int n)
+{
+    void * ptr = const_cast<double *>(data);
+    Py_ssize_t len = n * sizeof(double);
+#if PY_MAJOR_VERSION >= 3
+    Py_ssize_t shape = n;
+    Py_buffer view;
+    PyBuffer_FillInfo(&view, NULL, ptr, len, 1, PyBUF_FULL_RO);
+    view.format = const_cast<char *>("d");
+    view.itemsize = sizeof(double);
+    view.shape = &shape;
+    return object(handle<>(PyMemoryView_FromBuffer(&view)));
+#else
+    return object(handle<>(PyBuffer_FromMemory(ptr, len)));
+#endif
+}
+
+// Makes a view unusable once the data it refers to may be gone. Views
+// still exported (e.g. to numpy) can not be released and are kept.
+static void releaseView(object view)
+{
+#if PY_MAJOR_VERSION >= 3
+    PyObject * res = PyObject_CallMethod(view.ptr(), "release", NULL);
+    Py_XDECREF(res);
+    PyErr_Clear();
+#endif
+}
+
+// Appends the items of a python sequence to the given vector
+template <class T>
+static void fill(std::vector<T> &res, object sequence)
+{
+    int size = len(sequence);
+    res.reserve(res.size() + size);
+    for (int i = 0; i < size; ++i)
+    {
+        res.push_back(extract<T>(sequence[i]));
+    }
+}
+
+// Gets a contiguous buffer of at most one dimension exported by the
+// object (numpy arrays, memoryviews, ctypes and python 3 arrays...) and
+// its format character. Returns false (and clears the error) if there is
+// none.
+static bool getTypedBuffer(object sequence, Py_buffer &buffer, char &format)
+{
+    if (!PyObject_CheckBuffer(sequence.ptr())
+            || PyObject_GetBuffer(sequence.ptr(), &buffer,
+                PyBUF_FORMAT | PyBUF_ND) != 0)
+    {
+        PyErr_Clear();
+        return false;
+    }
+    const char * f = (buffer.format != NULL) ? buffer.format : "B";
+    // the byte order, if it is the native one (ctypes gives it); the
+    // callers check the item size
+    const unsigned short probe = 1;
+    char native = (*reinterpret_cast< const char * >(&probe) == 1) ? '<' : '>';
+    if (*f == '@' || *f == '=' || *f == native)
+    {
+        ++f;
+    }
+    if (buffer.ndim > 1 || f[0] == '\0' || f[1] != '\0')
+    {
+        PyBuffer_Release(&buffer);
+        return false;
+    }
+    format = f[0];
+    return true;
+}
+
+// Same as fill, copied at once from a buffer of ints (or of 64 bits
+// integers, checked) when the sequence exports one
+static void fillIndices(Indices &res, object sequence)
+{
+    Py_buffer buffer;
+    char format;
+    if (!getTypedBuffer(sequence, buffer, format))
+    {
+        fill(res, sequence);
+        return;
+    }
+    std::size_t size = (buffer.itemsize > 0) ? buffer.len / buffer.itemsize : 0;
+    std::size_t first = res.size();
+    if (format == 'i' && buffer.itemsize == sizeof(int))
+    {
+        res.resize(first + size);
+        std::copy(static_cast< const int * >(buffer.buf),
+                static_cast< const int * >(buffer.buf) + size,
+                res.begin() + first);
+    }
+    else if ((format == 'l' || format == 'q')
+            && buffer.itemsize == sizeof(boost::int64_t))
+    {
+        const boost::int64_t * wide =
+            static_cast< const boost::int64_t * >(buffer.buf);
+        res.resize(first + size);
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            if (wide[k] < INT_MIN || wide[k] > INT_MAX)
+            {
+                PyBuffer_Release(&buffer);
+                throw std::runtime_error("Index out of range");
+            }
+            res[first + k] = static_cast< int >(wide[k]);
+        }
+    }
+    else
+    {
+        PyBuffer_Release(&buffer);
+        fill(res, sequence);
+        return;
+    }
+    PyBuffer_Release(&buffer);
+}
+
+// Same as fill, copied at once from a buffer of doubles when the sequence
+// exports one
+static void fillValues(Values &res, object sequence)
+{
+    Py_buffer buffer;
+    char format;
+    if (!getTypedBuffer(sequence, buffer, format))
+    {
+        fill(res, sequence);
+        return;
+    }
+    if (format != 'd' || buffer.itemsize != sizeof(double))
+    {
+        PyBuffer_Release(&buffer);
+        fill(res, sequence);
+        return;
+    }
+    std::size_t size = buffer.len / sizeof(double);
+    const double * values = static_cast< const double * >(buffer.buf);
+    res.insert(res.end(), values, values + size);
+    PyBuffer_Release(&buffer);
+}
+
+// Forwards the solutions to a python callable, which returns None or
+// the violated rows as a tuple (starts, indices, values, lower, upper)
+class PyRowSeparator : public RowSeparator
+{
+    private:
+        object _callable;
+
+    public:
+        PyRowSeparator(object callable) : _callable(callable){}
+
+        virtual void separate(const double *x, int numCols, SparseBatch &rows)
+        {
+            object view = doubleView(x, numCols);
+            object res;
+            try
+            {
+                res = _callable(view);
+            }
+            catch (error_already_set &)
+            {
+                releaseView(view);
+                throw;
+            }
+            releaseView(view);
+            if (res.ptr() == Py_None)
+            {
+                return;
+            }
+            fill(rows.starts, res[0]);
+            fill(rows.indices, res[1]);
+            fill(rows.values, res[2]);
+            fill(rows.lower, res[3]);
+            fill(rows.upper, res[4]);
+        }
+};
+
+// Forwards the dual values to a python callable, which returns None or
+// the candidate columns as a tuple (starts, indices, values, lower,
+// upper, objective)
+class PyColumnPricer : public ColumnPricer
+{
+    private:
+        object _callable;
+
+    public:
+        PyColumnPricer(object callable) : _callable(callable){}
+
+        virtual void price(const double *duals, int numRows, SparseBatch &cols)
+        {
+            object view = doubleView(duals, numRows);
+            object res;
+            try
+            {
+                res = _callable(view);
+            }
+            catch (error_already_set &)
+            {
+                releaseView(view);
+                throw;
+            }
+            releaseView(view);
+            if (res.ptr() == Py_None)
+            {
+                return;
+            }
+            fill(cols.starts, res[0]);
+            fill(cols.indices, res[1]);
+            fill(cols.values, res[2]);
+            fill(cols.lower, res[3]);
+            fill(cols.upper, res[4]);
+            fill(cols.objective, res[5]);
+        }
+};
+
+// Forwards the MIP events to a python callable. The callable returns
+// True to stop the branch and bound. A python exception also stops it,
+// and is raised when solve returns.
+class PyMipEventListener : public MipEventListener
+{
+    private:
+        object _callable;
+
+    public:
+        PyMipEventListener(object callable) : _callable(callable){}
+
+        virtual bool onEvent(const MipEvent &event)
+        {
+            if (PyErr_Occurred())
+            {
+                return true;
+            }
+            try
+            {
+                object res = _callable(event);
+                return PyObject_IsTrue(res.ptr()) == 1;
+            }
+            catch (error_already_set &)
+            {
+                return true;
+            }
+        }
+};
+
+// Converts a vector of strings to a python list
+static list toList(const std::vector<std::string> &strings)
+{
+    list res;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+    {
+        res.append(strings[i]);
+    }
+    return res;
+}
+
+// The bytes of a buffer (bytes, bytearray, mmap...) in place, or a copy
+// of a string, for the time the object lives
+class BytesView
+{
+    private:
+        Py_buffer _buffer;
+
+        bool _hasBuffer;
+
+        std::string _copy;
+
+        // not copyable
+        BytesView(const BytesView &);
+        BytesView &operator=(const BytesView &);
+
+    public:
+        BytesView(object data)
+        {
+            _hasBuffer =
+                (PyObject_GetBuffer(data.ptr(), &_buffer, PyBUF_SIMPLE) == 0);
+            if (!_hasBuffer)
+            {
+                PyErr_Clear();
+                _copy = extract<std::string>(data);
+            }
+        }
+
+        ~BytesView()
+        {
+            if (_hasBuffer)
+            {
+                PyBuffer_Release(&_buffer);
+            }
+        }
+
+        const char * data() const
+        {
+            return _hasBuffer ? static_cast< const char * >(_buffer.buf)
+                : _copy.data();
+        }
+
+        std::size_t size() const
+        {
+            return _hasBuffer ? _buffer.len : _copy.size();
+        }
+};
+
+// A bytes object holding a copy of data
+static object toBytes(const std::string &data)
+{
+    return object(handle<>(PyBytes_FromStringAndSize(data.data(),
+                    data.size())));
+}
+
+// CoinPackedVectors built in one call, and the rows/columns added from
+// them
+struct PackedVector_helper
+{
+    static boost::shared_ptr< CoinPackedVector > fromArrays(object indices,
+            object values, bool coalesce)
+    {
+        Indices indicesVector;
+        Values valuesVector;
+        fillIndices(indicesVector, indices);
+        fillValues(valuesVector, values);
+        if (indicesVector.size() != valuesVector.size())
+        {
+            throw std::runtime_error(
+                    "indices and values must have the same length");
+        }
+        boost::shared_ptr< CoinPackedVector > res(new CoinPackedVector());
+        packed_helper::build(indicesVector.empty() ? NULL : &indicesVector[0],
+                valuesVector.empty() ? NULL : &valuesVector[0],
+                indicesVector.size(), coalesce, *res);
+        return res;
+    }
+
+    // pairs is a sequence of (index, value)
+    static CoinPackedVector fromPairs(object pairs)
+    {
+        int size = len(pairs);
+        Indices indices(size);
+        Values values(size);
+        for (int k = 0; k < size; ++k)
+        {
+            object pair = pairs[k];
+            if (len(pair) != 2)
+            {
+                throw std::runtime_error("Not an (index, value) pair");
+            }
+            indices[k] = extract<int>(pair[0]);
+            values[k] = extract<double>(pair[1]);
+        }
+        CoinPackedVector res;
+        packed_helper::build(size > 0 ? &indices[0] : NULL,
+                size > 0 ? &values[0] : NULL, size, false, res);
+        return res;
+    }
+
+    // vector is a CoinPackedVector or an (indices, values) pair
+    static CoinPackedVector toVector(object vector)
+    {
+        extract< CoinPackedVector& > packed(vector);
+        if (packed.check())
+        {
+            return packed();
+        }
+        if (len(vector) != 2)
+        {
+            throw std::runtime_error(
+                    "Expected a CoinPackedVector or (indices, values)");
+        }
+        return *fromArrays(vector[0], vector[1], false);
+    }
+
+    static Row addRow(Rows &rows, object vector)
+    {
+        return rows.add(toVector(vector));
+    }
+
+    static Row addRowArrays(Rows &rows, object indices, object values)
+    {
+        return rows.add(*fromArrays(indices, values, false));
+    }
+
+    static Col addCol(Cols &cols, object vector)
+    {
+        return cols.add(toVector(vector));
+    }
+
+    static Col addColArrays(Cols &cols, object indices, object values)
+    {
+        return cols.add(*fromArrays(indices, values, false));
+    }
+};
+
+// A problem is pickled as its solver name and its snapshot (see
+// Snapshot.hpp)
+struct Problem_pickle_suite : pickle_suite
+{
+    static tuple getinitargs(const Problem &problem)
+    {
+        return boost::python::make_tuple(problem.getSolverName());
+    }
+
+    static object getstate(const Problem &problem)
+    {
+        std::string data;
+        problem.saveBuffer(data, true);
+        return toBytes(data);
+    }
+
+    static void setstate(Problem &problem, object state)
+    {
+        BytesView bytes(state);
+        problem.loadBuffer(bytes.data(), bytes.size());
+    }
+};
+
+// Python-side wrappers around SolverPool
+struct SolverPool_helper
+{
+    static list compiledSolvers()
+    {
+        return toList(SolverPool::compiledSolvers());
+    }
+
+    static list availableSolvers()
+    {
+        return toList(SolverPool::availableSolvers());
+    }
+};
+
+// Formats of the compressed model files yaposib was built with
+static list availableCompressions()
+{
+    return toList(Compression::available());
+}
+
+// Python class of the ModelError exceptions (helpers.py registers its
+// YaposibError, RuntimeError until then)
+static PyObject * modelErrorClass = NULL;
+
+static void setErrorClass(object errorClass)
+{
+    Py_INCREF(errorClass.ptr());
+    modelErrorClass = errorClass.ptr();
+}
+
+static void translateModelError(const ModelError &error)
+{
+    PyErr_SetString(modelErrorClass != NULL ? modelErrorClass
+            : PyExc_RuntimeError, error.what());
+}
+
+// Releases the GIL while C++ code runs (no python call allowed)
+class AllowThreads
+{
+    private:
+        PyThreadState * _state;
+
+    public:
+        AllowThreads() : _state(PyEval_SaveThread()){}
+
+        ~AllowThreads()
+        {
+            PyEval_RestoreThread(_state);
+        }
+};
+
+// Python-side wrappers around Benders
+struct Benders_helper
+{
+    static void addSubproblem(Benders &benders, Problem &problem, int theta,
+            object rows, object starts, object cols, object values)
+    {
+        Indices rowsVector, startsVector, colsVector;
+        Values valuesVector;
+        fill(rowsVector, rows);
+        fill(startsVector, starts);
+        fill(colsVector, cols);
+        fill(valuesVector, values);
+        benders.addSubproblem(&problem, theta, rowsVector, startsVector,
+                colsVector, valuesVector);
+    }
+
+    static std::string solve(Benders &benders, int maxIterations, double tol)
+    {
+        AllowThreads allowThreads;
+        return benders.solve(maxIterations, tol);
+    }
+};
+
+// Python-side wrappers around BatchSolver
+struct BatchSolver_helper
+{
+    static int solve(BatchSolver &batch, object filenames,
+            std::string resultsFile)
+    {
+        std::vector< std::string > filenamesVector;
+        fill(filenamesVector, filenames);
+        AllowThreads allowThreads;
+        return batch.solve(filenamesVector, resultsFile);
+    }
+};
+
+// Python-side wrappers around Problem
+struct Problem_helper
+{
+    // Solves, then raises the exception a python callback may have left
+    static void solve(Problem &problem, bool considerMIP)
+    {
+        problem.solve(considerMIP);
+        if (PyErr_Occurred())
+        {
+            throw_error_already_set();
+        }
+    }
+
+    static void solveNormal(Problem &problem)
+    {
+        solve(problem, false);
+    }
+
+    static void solveMIP(Problem &problem)
+    {
+        solve(problem, true);
+    }
+
+    static int solveWithRowGeneration(Problem &problem, object separator,
+            int maxRounds, double tol, bool considerMIP)
+    {
+        PyRowSeparator pySeparator(separator);
+        int res = problem.solveWithRowGeneration(pySeparator, maxRounds, tol,
+                considerMIP);
+        if (PyErr_Occurred())
+        {
+            throw_error_already_set();
+        }
+        return res;
+    }
+
+    static int solveWithColumnGeneration(Problem &problem, object pricer,
+            int maxRounds, double tol, int purgeAge)
+    {
+        PyColumnPricer pyPricer(pricer);
+        int res = problem.solveWithColumnGeneration(pyPricer, maxRounds, tol,
+                purgeAge);
+        if (PyErr_Occurred())
+        {
+            throw_error_already_set();
+        }
+        return res;
+    }
+
+    static void readLpBuffer(Problem &problem, object data)
+    {
+        BytesView bytes(data);
+        problem.readLpBuffer(bytes.data(), bytes.size());
+    }
+
+    static void fromMpsBytes(Problem &problem, object data, int numThreads)
+    {
+        BytesView bytes(data);
+        problem.readMpsBuffer(bytes.data(), bytes.size(), numThreads);
+    }
+
+    static object toMpsBytes(const Problem &problem)
+    {
+        std::string text;
+        problem.writeMpsBuffer(text);
+        return toBytes(text);
+    }
+
+    static object toLpBytes(const Problem &problem)
+    {
+        std::string text;
+        problem.writeLpBuffer(text);
+        return toBytes(text);
+    }
+
+    static list exportSolution(const Problem &problem, std::string path,
+            std::string format, object what, bool names)
+    {
+        std::vector< std::string > whatVector;
+        fill(whatVector, what);
+        return toList(problem.exportSolution(path, format, whatVector,
+                    names));
+    }
+
+    static SolutionCheck checkSolution(const Problem &problem, object x,
+            double tolerance)
+    {
+        Values values;
+        fillValues(values, x);
+        return problem.checkSolution(values, tolerance);
+    }
+
+    static std::string fingerprint(const Problem &problem, object parts)
+    {
+        std::vector< std::string > partsVector;
+        fill(partsVector, parts);
+        return problem.fingerprint(partsVector);
+    }
+
+    // Each objective is a CoinPackedVector, or a sequence of coefficients
+    // (one per column)
+    static int solveLexicographic(Problem &problem, object objectives,
+            object tolerances, bool considerMIP)
+    {
+        std::vector< CoinPackedVector > objectivesVector(len(objectives));
+        for (std::size_t k = 0; k < objectivesVector.size(); ++k)
+        {
+            extract< CoinPackedVector& > packed(objectives[k]);
+            if (packed.check())
+            {
+                objectivesVector[k] = packed();
+                continue;
+            }
+            Values dense;
+            fill(dense, objectives[k]);
+            for (std::size_t j = 0; j < dense.size(); ++j)
+            {
+                if (dense[j] != 0)
+                {
+                    objectivesVector[k].insert(j, dense[j]);
+                }
+            }
+        }
+        Values tolerancesVector;
+        fill(tolerancesVector, tolerances);
+        return problem.solveLexicographic(objectivesVector, tolerancesVector,
+                considerMIP);
+    }
+
+    static void setMipStart(Problem &problem, object indices, object values)
+    {
+        Indices indicesVector;
+        Values valuesVector;
+        fill(indicesVector, indices);
+        fill(valuesVector, values);
+        problem.setMipStart(indicesVector, valuesVector);
+    }
+
+    static void setMipEventCallback(Problem &problem, object callable)
+    {
+        if (callable.ptr() == Py_None)
+        {
+            problem.setMipEventListener(boost::shared_ptr< MipEventListener >());
+        }
+        else
+        {
+            problem.setMipEventListener(boost::shared_ptr< MipEventListener >(
+                        new PyMipEventListener(callable)));
+        }
+    }
+
+    static list pollMipEvents(Problem &problem)
+    {
+        list res;
+        std::vector< MipEvent > events = problem.pollMipEvents();
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            res.append(events[i]);
+        }
+        return res;
+    }
+};
+
 BOOST_PYTHON_MODULE(_yaposib)
 {
     // See "Problem.hpp"
     class_<Problem>("Problem", "LP problem", init<std::string>())
+        .add_property("solverName",
+                &Problem::getSolverName,
+                "The name of the solver in use"
+                )
         .add_property("obj",
                 &Problem::getObj,
                 "The objective as a manipulable object")
@@ -22,6 +699,14 @@ BOOST_PYTHON_MODULE(_yaposib)
         .add_property("cols",
                 &Problem::getCols,
                 "The columns as a manipulable object")
+        .def("clear",
+                &Problem::clear,
+                (arg("keepParams") = true),
+                "Empties the problem (rows, columns and names) but keeps the "
+                "internal solver and its allocations, so that it can be "
+                "filled again. If keepParams is False, the solver parameters "
+                "are also reset to their defaults."
+                )
         .def("markHotStart",
                 &Problem::markHotStart,
                 "Makes an internal optimization snapshot of the problem (warmstart)"
@@ -31,7 +716,7 @@ BOOST_PYTHON_MODULE(_yaposib)
                 "Deletes the internal snapshot of the problem (if existing)"
                 )
         .def("solve",
-                &Problem::solve,
+                &Problem_helper::solve,
                 "Solves the internal problem:\n"
                 "- If an internal snapshot exists, use it.\n"
                 "- If the problem has already been solved, use the internal OSI resolve.\n"
@@ -39,9 +724,131 @@ BOOST_PYTHON_MODULE(_yaposib)
                 "OSI bug: the shadow prices may be wrong for MIP."
                 )
         .def("solve",
-                &Problem::solveNormal)
+                &Problem_helper::solveNormal)
         .def("solveMIP",
-                &Problem::solveMIP)
+                &Problem_helper::solveMIP)
+        .def("setMipStart",
+                &Problem_helper::setMipStart,
+                (arg("indices"), arg("values")),
+                "Sets a known assignment of the given columns, given to the "
+                "next branch and bounds as a first incumbent. Cbc, Cplex and "
+                "Gurobi use their MIP start mechanism, the other solvers only "
+                "get it as column solution."
+                )
+        .def("clearMipStart",
+                &Problem::clearMipStart,
+                "Forgets the MIP start"
+                )
+        .add_property("mipStartIndices",
+                make_function(&Problem::getMipStartIndices,
+                    return_value_policy<copy_const_reference>()),
+                "Indices: columns of the MIP start, renumbered when columns "
+                "are deleted"
+                )
+        .add_property("mipStartValues",
+                make_function(&Problem::getMipStartValues,
+                    return_value_policy<copy_const_reference>()),
+                "Values: values of the MIP start"
+                )
+        .def("solveWithRowGeneration",
+                &Problem_helper::solveWithRowGeneration,
+                (arg("separator"), arg("maxRounds") = 100, arg("tol") = 1e-6,
+                 arg("considerMIP") = false),
+                "Row generation loop. Solves, then calls separator with a "
+                "read-only view on the solution (valid during the call "
+                "only). It returns None or the rows to add, as a tuple "
+                "(starts, indices, values, lower, upper) in compressed "
+                "sparse row form. Rows violated by more than tol are added "
+                "at once and the problem is resolved (warm), until no row is "
+                "violated or maxRounds solves were made. Returns the number "
+                "of solves."
+                )
+        .def("solveLexicographic",
+                &Problem_helper::solveLexicographic,
+                (arg("objectives"), arg("tolerances") = tuple(),
+                 arg("considerMIP") = false),
+                "Optimizes each objective (a vec, or one coefficient per "
+                "column) in turn, in the sense of obj.maximize, from the basis "
+                "of the previous stage. After a stage, a row named 'lex_<k>' "
+                "keeps the objective within tolerances[k] (relative, 0 if "
+                "missing) of its optimal value. The last objective stays the "
+                "objective, and the rows are kept. Stops at the first stage "
+                "that is not optimal. Returns the number of stages solved."
+                )
+        .def("solveWithColumnGeneration",
+                &Problem_helper::solveWithColumnGeneration,
+                (arg("pricer"), arg("maxRounds") = 100, arg("tol") = 1e-6,
+                 arg("purgeAge") = 0),
+                "Column generation loop. Solves, then calls pricer with a "
+                "read-only view on the dual values (valid during the call "
+                "only). It returns None or candidate columns, as a tuple "
+                "(starts, indices, values, lower, upper, objective) in "
+                "compressed sparse column form. Columns whose reduced cost "
+                "improves the objective by more than tol are added at once "
+                "and the problem is resolved (warm), until no column improves "
+                "or maxRounds solves were made. If purgeAge is positive, "
+                "generated columns that stayed non basic for purgeAge solves "
+                "are deleted. Returns the number of solves."
+                )
+        .def("setMipEventCallback",
+                &Problem_helper::setMipEventCallback,
+                "Sets a callable receiving each MipEvent while the branch and "
+                "bound runs. It returns True to stop the search. None removes "
+                "it.\n"
+                "Only Cbc reports events during the search."
+                )
+        .def("pollMipEvents",
+                &Problem_helper::pollMipEvents,
+                "Returns the list of MipEvents recorded since the last poll"
+                )
+        .add_property("mipEventInterval",
+                &Problem::getMipEventInterval,
+                &Problem::setMipEventInterval,
+                "A 'node' event is reported every mipEventInterval nodes"
+                )
+        .add_property("mipGapLimit",
+                &Problem::getMipGapLimit,
+                &Problem::setMipGapLimit,
+                "The branch and bound stops as soon as the relative gap "
+                "falls under this value (negative to disable)"
+                )
+        .def("fingerprint",
+                &Problem_helper::fingerprint,
+                (arg("parts") = boost::python::make_tuple("structure",
+                    "coefficients", "bounds", "objective")),
+                "128 bits hash (32 hexadecimal digits) of the selected parts "
+                "of the problem: 'structure' (sizes, positions of the matrix "
+                "entries, integrality), 'coefficients', 'bounds' and "
+                "'objective'. Names are not hashed."
+                )
+        .add_property("solutionCache",
+                &Problem::getSolutionCache,
+                &Problem::setSolutionCache,
+                "SolutionCache looked up before solving, and fed with the "
+                "optimal results only (None to disable)"
+                )
+        .def("memoryUsage",
+                &Problem::getMemoryUsage,
+                "MemoryUsage: bytes held by the problem, part by part"
+                )
+        .def("checkSolution",
+                &Problem_helper::checkSolution,
+                (arg("x"), arg("tol") = 1e-6),
+                "SolutionCheck: violations of the rows, bounds and "
+                "integrality by the column values x (a sequence or a buffer "
+                "of doubles), and their objective. Nothing is solved, and the "
+                "solution of the problem is left as it is."
+                )
+        .def("analyze",
+                &Problem::analyze,
+                "ModelStats: sizes, nonzeros histograms and ranges of the "
+                "coefficients of the model"
+                )
+        .add_property("stats",
+                make_function(&Problem::getStats,
+                    return_value_policy<copy_const_reference>()),
+                "SolveStats of the last solve"
+                )
         .add_property("status",
                 &Problem::getSolverStatus,
                 "A string describing the solver status:\n"
@@ -57,26 +864,127 @@ BOOST_PYTHON_MODULE(_yaposib)
                 )
         .def("readLp",
                 &Problem::readLp,
-                "Read the problem from an lp file. Return the error count"
+                "Read the problem from an lp file. Return the error count. "
+                "A file ending with a built in compression ('.gz', '.bz2', "
+                "'.zst') is read by readLpNative"
                 )
         .def("readMps",
                 &Problem::readMps,
-                "Read the problem from an mps file. Return the error count."
-                )
+                "Read the problem from an mps file. Return the error count. "
+                "A file ending with a built in compression ('.gz', '.bz2', "
+                "'.zst') is read by readMpsNative"
+                )
+        .def("readLpNative",
+                &Problem::readLpNative,
+                "Read the problem from an lp file with yaposib's reader: the "
+                "file is mapped in memory, parsed in a single pass and the "
+                "model is given to the solver at once. Raises on the first "
+                "error."
+                )
+        .def("readLpBuffer",
+                &Problem_helper::readLpBuffer,
+                "Same as readLpNative, from a string or a buffer (bytes, "
+                "bytearray, mmap...), which is read in place"
+                )
+        .def("readMpsNative",
+                &Problem::readMpsNative,
+                (arg("filename"), arg("numThreads") = 0),
+                "Read the problem from an mps file (fixed or free, names "
+                "without spaces) with yaposib's reader: the file is mapped in "
+                "memory, its COLUMNS section is parsed by numThreads threads "
+                "(0: as many as OpenMP wants) and the model is given to the "
+                "solver at once. Raises on the first error."
+                )
+        .def("save",
+                &Problem::save,
+                (arg("filename"), arg("withNames") = true),
+                "Write the whole state of the problem (matrix, bounds, "
+                "objective, integrality, names, parameters, basis and last "
+                "solution) in a binary file, compressed if its name ends with "
+                "'.gz', '.bz2' or '.zst'"
+                )
+        .def("load",
+                &Problem::load,
+                "Replace the whole state of the problem with the one saved in "
+                "the file. The basis is given to the solver as warm start."
+                )
+        .def("loadScenario",
+                &Problem::loadScenario,
+                "Give the scenario to the solver. If the solver already holds "
+                "the matrix of its model (no row or column was added or "
+                "deleted since the previous scenario of that model), only the "
+                "bounds and the objective are set and the next solve resumes "
+                "from the current basis."
+                )
+        .def("compact",
+                &Problem::compact,
+                "Replace the solver's matrix with a tightly packed copy. The "
+                "model is not reloaded: basis, last solution and indices are "
+                "kept."
+                )
+        .add_property("matrixGapRatio",
+                &Problem::getMatrixGapRatio,
+                "Fraction of the stored matrix entries that are gaps"
+                )
+        .add_property("autoCompactRatio",
+                &Problem::getAutoCompactRatio,
+                &Problem::setAutoCompactRatio,
+                "Before a solve, the problem is compacted when matrixGapRatio "
+                "exceeds this value (negative to disable)"
+                )
+        .def_pickle(Problem_pickle_suite())
         .def("writeLp",
                 &Problem::writeLp,
                 "Write the problem in a lp file. The argument is appended "
-                "the extension '.lp'"
+                "the extension '.lp', unless it ends with '.gz', '.bz2' or "
+                "'.zst' and that compression was built in: then the file "
+                "is written as is, compressed, by yaposib's writer"
                 )
         .def("writeLp",
                 &Problem::writeDefaultLp)
         .def("writeMps",
                 &Problem::writeMps,
                 "Write the problem in a mps file. The argument is appended "
-                "the extension '.mps'"
+                "the extension '.mps', unless it ends with '.gz', '.bz2' or "
+                "'.zst' and that compression was built in: then the file "
+                "is written as is, compressed, in free mps by yaposib's "
+                "writer"
                 )
-        .def("writeLp",
+        .def("writeMps",
                 &Problem::writeDefaultMps)
+        .def("toMpsBytes",
+                &Problem_helper::toMpsBytes,
+                "The problem in free mps format, as bytes (names that mps "
+                "can not hold are replaced)"
+                )
+        .def("toLpBytes",
+                &Problem_helper::toLpBytes,
+                "The problem in lp format, as bytes (names that lp can not "
+                "hold are replaced)"
+                )
+        .def("fromMpsBytes",
+                &Problem_helper::fromMpsBytes,
+                (arg("data"), arg("numThreads") = 0),
+                "Read the problem from mps in memory (bytes, bytearray, "
+                "mmap... read in place), as readMpsNative reads a file"
+                )
+        .def("fromLpBytes",
+                &Problem_helper::readLpBuffer,
+                "Read the problem from lp in memory, as readLpBuffer"
+                )
+        .def("exportSolution",
+                &Problem_helper::exportSolution,
+                (arg("path"), arg("format") = "npy",
+                 arg("what") = boost::python::make_tuple("primal", "dual",
+                     "reduced", "activity"),
+                 arg("names") = true),
+                "Write the solution vectors listed in what ('primal', "
+                "'reduced', 'dual', 'activity') in a single pass. With format "
+                "'npy', each vector goes in <path>.<vector>.npy and the names "
+                "in <path>.colnames.npy and <path>.rownames.npy. With format "
+                "'csv', the column vectors go in <path>.cols.csv and the row "
+                "vectors in <path>.rows.csv. Return the files written."
+                )
         .add_property("maxNumIterations",
                 &Problem::getMaxNumIterations,
                 &Problem::setMaxNumIterations,
@@ -198,9 +1106,493 @@ BOOST_PYTHON_MODULE(_yaposib)
                 )
     ;
 
+    // See "SolverPool.hpp"
+    class_<SolverPool>("SolverPool",
+            "Registry of the solvers, and pool of idle solver interfaces. "
+            "Interfaces released by a Problem are reset and kept (up to "
+            "capacity per solver) for the next Problem.",
+            no_init)
+        .def("compiledSolvers",
+                &SolverPool_helper::compiledSolvers,
+                "Names of the solvers yaposib was compiled with"
+                )
+        .staticmethod("compiledSolvers")
+        .def("availableSolvers",
+                &SolverPool_helper::availableSolvers,
+                "Names of the solvers that can be instanciated (probed once "
+                "per process)"
+                )
+        .staticmethod("availableSolvers")
+        .def("isAvailable",
+                &SolverPool::isAvailable,
+                "Can the given solver be instanciated?"
+                )
+        .staticmethod("isAvailable")
+        .def("supportsMip",
+                &SolverPool::supportsMip,
+                "Does the given solver implement a branch and bound?"
+                )
+        .staticmethod("supportsMip")
+        .def("prewarm",
+                &SolverPool::prewarm,
+                "Builds interfaces of the given solver until count of them "
+                "are idle. Raises the capacity if needed."
+                )
+        .staticmethod("prewarm")
+        .def("getCapacity",
+                &SolverPool::getCapacity,
+                "Maximum number of idle interfaces kept per solver"
+                )
+        .staticmethod("getCapacity")
+        .def("setCapacity",
+                &SolverPool::setCapacity,
+                "Sets the maximum number of idle interfaces kept per solver "
+                "(0 disables pooling)"
+                )
+        .staticmethod("setCapacity")
+        .def("size",
+                &SolverPool::size,
+                "Number of idle interfaces of the given solver"
+                )
+        .staticmethod("size")
+        .def("clear",
+                &SolverPool::clear,
+                "Destroys every idle interface"
+                )
+        .staticmethod("clear")
+    ;
+
+    // See "Benders.hpp"
+    class_<Benders>("Benders",
+            "Benders decomposition of a two-stage problem. The master "
+            "(minimization) holds the first stage variables x and a column "
+            "theta per group of subproblems, approximating their cost. The "
+            "subproblems (minimization) depend on x through rows whose "
+            "bounds are shifted by -T x.",
+            init<Problem *>()[with_custodian_and_ward<1, 2>()])
+        .def("addSubproblem",
+                &Benders_helper::addSubproblem,
+                with_custodian_and_ward<1, 2>(),
+                (arg("problem"), arg("theta"), arg("rows"), arg("starts"),
+                 arg("cols"), arg("values")),
+                "Adds a subproblem whose cost is approximated by the master "
+                "column theta (subproblems sharing a theta are summed). rows "
+                "are its rows depending on x, and the row k of T is made of "
+                "the entries starts[k] to starts[k+1] of cols (master "
+                "columns) and values. The current bounds of these rows are "
+                "their bounds when x = 0."
+                )
+        .def("solve",
+                &Benders_helper::solve,
+                (arg("maxIterations") = 100, arg("tol") = 1e-6),
+                "Solves the subproblems in parallel and adds the cuts to the "
+                "master at once, until the relative gap is under tol, no cut "
+                "is violated or maxIterations iterations were made. Returns "
+                "'optimal', 'limitreached', 'infeasible' or 'abandoned'."
+                )
+        .def("__len__",
+                &Benders::size,
+                "Number of subproblems"
+                )
+        .add_property("lowerBound",
+                &Benders::getLowerBound,
+                "Best lower bound (objective of the master)"
+                )
+        .add_property("upperBound",
+                &Benders::getUpperBound,
+                "Best upper bound (cost of the best first stage found)"
+                )
+        .add_property("iterations",
+                &Benders::getIterations,
+                "Number of iterations of the last solve"
+                )
+        .add_property("numThreads",
+                &Benders::getNumThreads,
+                &Benders::setNumThreads,
+                "Number of threads solving the subproblems (0: OpenMP default)"
+                )
+    ;
+
+    // See "BatchSolver.hpp"
+    class_<BatchSolver>("BatchSolver",
+            "Solves a set of model files (mps, or lp if the name ends with "
+            "'.lp', optionally compressed) independently, in parallel. Each "
+            "worker reads its next file while it solves the current one.",
+            init<std::string>())
+        .def("solve",
+                &BatchSolver_helper::solve,
+                (arg("filenames"), arg("resultsFile") = "-"),
+                "Solves the files and writes a result line per instance as "
+                "soon as it is finished (file, status, objective, time, "
+                "readTime, iterations, nodes, solution, error), as JSON lines "
+                "or as CSV if resultsFile ends with '.csv' ('-': standard "
+                "output). Returns the number of optimal instances."
+                )
+        .add_property("numThreads",
+                &BatchSolver::getNumThreads,
+                &BatchSolver::setNumThreads,
+                "Number of workers (0: OpenMP default)"
+                )
+        .add_property("considerMIP",
+                &BatchSolver::getConsiderMIP,
+                &BatchSolver::setConsiderMIP,
+                "Are integer variables considered (if the solver can)?"
+                )
+        .add_property("solutionDir",
+                &BatchSolver::getSolutionDir,
+                &BatchSolver::setSolutionDir,
+                "If not empty, the column solution of each optimal instance "
+                "is written there as <name>.npy"
+                )
+    ;
+
+    // See "Callbacks.hpp"
+    class_<MipEvent>("MipEvent", "Progress report of a branch and bound")
+        .def_readonly("kind",
+                &MipEvent::kind,
+                "'incumbent', 'bound', 'node' or 'finished'"
+                )
+        .def_readonly("nodes",
+                &MipEvent::nodes,
+                "number of nodes explored so far (-1 if unknown)"
+                )
+        .def_readonly("objective",
+                &MipEvent::objective,
+                "value of the best integer solution"
+                )
+        .def_readonly("bound",
+                &MipEvent::bound,
+                "best possible objective value"
+                )
+        .def_readonly("gap",
+                &MipEvent::gap,
+                "relative gap between objective and bound"
+                )
+    ;
+
+    // See "SolveStats.hpp"
+    class_<SolveStats>("SolveStats", "What the last solve cost (seconds)")
+        .def_readonly("lpPhase",
+                &SolveStats::lpPhase,
+                "'initialSolve', 'resolve' or 'hotStart'"
+                )
+        .def_readonly("lpWallTime",
+                &SolveStats::lpWallTime
+                )
+        .def_readonly("lpCpuTime",
+                &SolveStats::lpCpuTime,
+                "CPU time of the calling thread"
+                )
+        .def_readonly("mipWallTime",
+                &SolveStats::mipWallTime,
+                "0 if the MIP was not considered"
+                )
+        .def_readonly("mipCpuTime",
+                &SolveStats::mipCpuTime,
+                "CPU time of the calling thread, 0 if the MIP was not "
+                "considered"
+                )
+        .def_readonly("lpIterations",
+                &SolveStats::lpIterations
+                )
+        .def_readonly("mipIterations",
+                &SolveStats::mipIterations
+                )
+        .def_readonly("nodes",
+                &SolveStats::nodes,
+                "nodes of the branch and bound (-1 if unknown)"
+                )
+        .def_readonly("peakRssDelta",
+                &SolveStats::peakRssDelta,
+                "growth of the peak resident set size of the whole process "
+                "during the solve (kB), other threads included"
+                )
+        .def_readonly("modelTime",
+                &SolveStats::modelTime,
+                "wall time between the previous solve (or the creation of "
+                "the problem) and this one"
+                )
+    ;
+
+    // See "Model.hpp"
+    class_<Model>("Model",
+            "Immutable copy of a problem, shared by its scenarios",
+            init<const Problem&>())
+        .add_property("numRows", &Model::getNumRows, "number of rows")
+        .add_property("numCols", &Model::getNumCols, "number of columns")
+        .add_property("numElements",
+                &Model::getNumElements,
+                "number of matrix entries"
+                )
+    ;
+
+    // See "Model.hpp"
+    class_<Scenario>("Scenario",
+            "Bounds and objective coefficients that differ from a model",
+            init<const Model&>())
+        .add_property("model",
+                make_function(&Scenario::getModel,
+                    return_value_policy<copy_const_reference>()),
+                "the shared model"
+                )
+        .def("setColBounds",
+                &Scenario::setColBounds,
+                (arg("index"), arg("lower"), arg("upper")),
+                "bounds of a column in this scenario"
+                )
+        .def("setRowBounds",
+                &Scenario::setRowBounds,
+                (arg("index"), arg("lower"), arg("upper")),
+                "bounds of a row in this scenario"
+                )
+        .def("setObjCoef",
+                &Scenario::setObjCoef,
+                (arg("index"), arg("value")),
+                "objective coefficient of a column in this scenario"
+                )
+        .def("__len__",
+                &Scenario::size,
+                "number of values that differ from the model"
+                )
+    ;
+
+    // See "SolutionCache.hpp"
+    class_<SolutionCache, boost::shared_ptr< SolutionCache >,
+            boost::noncopyable>("SolutionCache",
+            "Results of earlier solves, most recently used in memory, "
+            "optionally all of them in a directory",
+            init<std::size_t, std::string>(
+                (arg("maxBytes") = 256 << 20, arg("directory") = "")))
+        .def("clear",
+                &SolutionCache::clear,
+                "forget the results in memory (the files are kept)"
+                )
+        .def("__len__",
+                &SolutionCache::size,
+                "number of results in memory"
+                )
+        .add_property("bytes",
+                &SolutionCache::getBytes,
+                "bytes of the results in memory"
+                )
+        .add_property("maxBytes",
+                &SolutionCache::getMaxBytes,
+                &SolutionCache::setMaxBytes,
+                "the least recently used results are evicted beyond this"
+                )
+        .add_property("directory",
+                &SolutionCache::getDirectory,
+                "where every result is also written ('': memory only)"
+                )
+        .add_property("hits", &SolutionCache::getHits, "number of hits")
+        .add_property("misses", &SolutionCache::getMisses, "number of misses")
+    ;
+
+    // See "MemoryUsage.hpp"
+    class_<MemoryUsage>("MemoryUsage", "Bytes held by a problem")
+        .def_readonly("matrixByCol",
+                &MemoryUsage::matrixByCol,
+                "column major copy of the matrix (gaps included)"
+                )
+        .def_readonly("matrixByRow",
+                &MemoryUsage::matrixByRow,
+                "row major copy of the matrix"
+                )
+        .def_readonly("bounds",
+                &MemoryUsage::bounds,
+                "bounds, objective, integrality, row sense/rhs/range"
+                )
+        .def_readonly("solution",
+                &MemoryUsage::solution,
+                "primal and dual values, reduced costs, activities"
+                )
+        .def_readonly("names",
+                &MemoryUsage::names,
+                "names of the rows and columns"
+                )
+        .def_readonly("warmStart",
+                &MemoryUsage::warmStart,
+                "basis the solver would warm start from"
+                )
+        .def_readonly("handles",
+                &MemoryUsage::handles,
+                "yaposib's Row and Col handles"
+                )
+        .def_readonly("mipData",
+                &MemoryUsage::mipData,
+                "MIP start and MIP events waiting to be polled"
+                )
+        .def_readonly("matrixGaps",
+                &MemoryUsage::matrixGaps,
+                "unused entries of the column major copy (in matrixByCol)"
+                )
+        .add_property("total",
+                &MemoryUsage::total,
+                "sum of the parts"
+                )
+    ;
+
+    // See "SolutionCheck.hpp"
+    class_<SolutionCheck>("SolutionCheck", "Violations of a candidate solution")
+        .def_readonly("maxRowViolation",
+                &SolutionCheck::maxRowViolation,
+                "largest violation of a row bound"
+                )
+        .def_readonly("sumRowViolations",
+                &SolutionCheck::sumRowViolations,
+                "sum of the violations of the row bounds"
+                )
+        .def_readonly("numRowViolations",
+                &SolutionCheck::numRowViolations,
+                "number of rows violated by more than tol"
+                )
+        .def_readonly("maxBoundViolation",
+                &SolutionCheck::maxBoundViolation,
+                "largest violation of a column bound"
+                )
+        .def_readonly("sumBoundViolations",
+                &SolutionCheck::sumBoundViolations,
+                "sum of the violations of the column bounds"
+                )
+        .def_readonly("numBoundViolations",
+                &SolutionCheck::numBoundViolations,
+                "number of columns out of their bounds by more than tol"
+                )
+        .def_readonly("maxIntegralityViolation",
+                &SolutionCheck::maxIntegralityViolation,
+                "largest distance of an integer column to an integer"
+                )
+        .def_readonly("sumIntegralityViolations",
+                &SolutionCheck::sumIntegralityViolations,
+                "sum of the distances of the integer columns to an integer"
+                )
+        .def_readonly("numIntegralityViolations",
+                &SolutionCheck::numIntegralityViolations,
+                "number of integer columns farther than tol from an integer"
+                )
+        .def_readonly("objValue",
+                &SolutionCheck::objValue,
+                "objective of the candidate, as obj.value reports it"
+                )
+        .def_readonly("feasible",
+                &SolutionCheck::feasible,
+                "no violation above tol"
+                )
+    ;
+
+    // See "ModelStats.hpp"
+    class_<ModelStats>("ModelStats", "Sizes and numerics of a model")
+        .def_readonly("numRows",
+                &ModelStats::numRows,
+                "number of rows"
+                )
+        .def_readonly("numCols",
+                &ModelStats::numCols,
+                "number of columns"
+                )
+        .def_readonly("numElements",
+                &ModelStats::numElements,
+                "number of nonzeros"
+                )
+        .def_readonly("rowHistogram",
+                &ModelStats::rowHistogram,
+                "Indices: number of rows with 0, 1, 2-3, 4-7... nonzeros"
+                )
+        .def_readonly("colHistogram",
+                &ModelStats::colHistogram,
+                "Indices: number of columns with 0, 1, 2-3, 4-7... nonzeros"
+                )
+        .def_readonly("minCoefficient",
+                &ModelStats::minCoefficient,
+                "smallest nonzero |coefficient| of the matrix"
+                )
+        .def_readonly("maxCoefficient",
+                &ModelStats::maxCoefficient,
+                "largest |coefficient| of the matrix"
+                )
+        .def_readonly("minObjective",
+                &ModelStats::minObjective,
+                "smallest nonzero finite |objective coefficient|"
+                )
+        .def_readonly("maxObjective",
+                &ModelStats::maxObjective,
+                "largest finite |objective coefficient|"
+                )
+        .def_readonly("minRhs",
+                &ModelStats::minRhs,
+                "smallest nonzero finite |row bound|"
+                )
+        .def_readonly("maxRhs",
+                &ModelStats::maxRhs,
+                "largest finite |row bound|"
+                )
+        .def_readonly("minBound",
+                &ModelStats::minBound,
+                "smallest nonzero finite |column bound|"
+                )
+        .def_readonly("maxBound",
+                &ModelStats::maxBound,
+                "largest finite |column bound|"
+                )
+        .def_readonly("numFreeCols",
+                &ModelStats::numFreeCols,
+                "columns without bounds"
+                )
+        .def_readonly("numFixedCols",
+                &ModelStats::numFixedCols,
+                "columns with equal bounds"
+                )
+        .def_readonly("numIntegerCols",
+                &ModelStats::numIntegerCols,
+                "integer columns"
+                )
+        .def_readonly("numBinaryCols",
+                &ModelStats::numBinaryCols,
+                "integer columns within [0, 1]"
+                )
+        .def_readonly("numFreeRows",
+                &ModelStats::numFreeRows,
+                "rows without bounds"
+                )
+        .def_readonly("numEqualityRows",
+                &ModelStats::numEqualityRows,
+                "rows with equal bounds"
+                )
+        .def_readonly("numEmptyRows",
+                &ModelStats::numEmptyRows,
+                "rows without nonzeros"
+                )
+        .def_readonly("numSingletonRows",
+                &ModelStats::numSingletonRows,
+                "rows with one nonzero"
+                )
+        .def_readonly("numEmptyCols",
+                &ModelStats::numEmptyCols,
+                "columns without nonzeros"
+                )
+        .def_readonly("numSingletonCols",
+                &ModelStats::numSingletonCols,
+                "columns with one nonzero"
+                )
+    ;
+
     // See OSI's CoinPackedVector. It's write only, read should not be
     // needed.
     class_<CoinPackedVector>("CoinPackedVector", init<>())
+        .def("__init__",
+                make_constructor(&PackedVector_helper::fromArrays,
+                    default_call_policies(),
+                    (arg("indices"), arg("values"), arg("coalesce") = false)),
+                "Builds the vector in one call from the sequences (or "
+                "buffers, e.g. numpy arrays of int32/int64 and float64) of "
+                "indices and values. If coalesce, the pairs are sorted by "
+                "index and the values of a repeated index summed, otherwise "
+                "a repeated index raises.")
+        .def("fromPairs",
+                &PackedVector_helper::fromPairs,
+                "Builds the vector from a sequence of (index, value) pairs "
+                "in one call. A repeated index raises.")
+        .staticmethod("fromPairs")
         .def("insert",
                 &CoinPackedVector::insert,
                 "Inserts the pair argument in the vector (index, value)")
@@ -265,8 +1657,14 @@ BOOST_PYTHON_MODULE(_yaposib)
     // See "Row.hpp"
     class_<Rows>("Rows", "Every rows (constraints) of a problem")
         .def("add",
-                &Rows::add,
-                "Adds the given row to the problem and returns a Row object"
+                &PackedVector_helper::addRow,
+                "Adds the given row (a CoinPackedVector, or a pair "
+                "(indices, values)) to the problem and returns a Row object"
+                )
+        .def("add",
+                &PackedVector_helper::addRowArrays,
+                (arg("indices"), arg("values")),
+                "Adds the row of the given indices and values"
                 )
         .def("__len__",
                 &Rows::size,
@@ -335,8 +1733,14 @@ BOOST_PYTHON_MODULE(_yaposib)
     // See "Col.hpp"
     class_<Cols>("Cols", "Every columns (variables) of a problem")
         .def("add",
-                &Cols::add,
-                "adds the given column (returns a Col object)"
+                &PackedVector_helper::addCol,
+                "adds the given column (a CoinPackedVector, or a pair "
+                "(indices, values)) and returns a Col object"
+                )
+        .def("add",
+                &PackedVector_helper::addColArrays,
+                (arg("indices"), arg("values")),
+                "adds the column of the given indices and values"
                 )
         .def("__len__",
                 &Cols::size,
@@ -386,5 +1790,18 @@ BOOST_PYTHON_MODULE(_yaposib)
                 "set the coefficient with the given index"
                 )
     ;
+
+    def("availableCompressions",
+            &availableCompressions,
+            "Formats of the compressed model files (\"gzip\", \"bzip2\", "
+            "\"zstd\") that can be read and written"
+            );
+
+    register_exception_translator<ModelError>(&translateModelError);
+    def("setErrorClass",
+            &setErrorClass,
+            "Sets the class of the exceptions raised for invalid models "
+            "(used by yaposib to raise its YaposibError)"
+            );
 }
 
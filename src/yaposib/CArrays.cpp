@@ -3,7 +3,13 @@
 /// @author Christophe-Marie Duquesne <chmd@chmd.fr>
 /// created the 2010-07-24
 
+// OSI includes
+#include <coin/CoinPackedVector.hpp>
+
+// std includes
 #include <stdexcept>
+#include <algorithm>
+#include <utility>
 
 const double values_helper::get(Values const& x, int i)
 {
@@ -19,3 +25,64 @@ const int indices_helper::get(Indices const& x, int i)
     throw std::runtime_error("Index out of range");
 }
 
+
+// Orders the pairs by index only, so that stable_sort keeps the order in
+// which the values of a repeated index are summed
+static bool lessIndex(const std::pair< int, double > &a,
+        const std::pair< int, double > &b)
+{
+    return a.first < b.first;
+}
+
+void packed_helper::build(const int * indices, const double * values,
+        int size, bool coalesce, CoinPackedVector &res)
+{
+    bool sorted = true;
+    for (int k = 0; k < size; ++k)
+    {
+        if (indices[k] < 0)
+        {
+            throw std::runtime_error("Negative index in vector");
+        }
+        sorted = sorted && (k == 0 || indices[k-1] < indices[k]);
+    }
+    if (sorted)
+    {
+        // no repeated index
+        res.setVector(size, indices, values, false);
+        return;
+    }
+    std::vector< std::pair< int, double > > pairs(size);
+    for (int k = 0; k < size; ++k)
+    {
+        pairs[k] = std::make_pair(indices[k], values[k]);
+    }
+    std::stable_sort(pairs.begin(), pairs.end(), lessIndex);
+    Indices uniqueIndices;
+    Values uniqueValues;
+    uniqueIndices.reserve(size);
+    uniqueValues.reserve(size);
+    for (int k = 0; k < size; ++k)
+    {
+        if (!uniqueIndices.empty() && uniqueIndices.back() == pairs[k].first)
+        {
+            if (!coalesce)
+            {
+                throw std::runtime_error(
+                        "Twice the same index in vector");
+            }
+            uniqueValues.back() += pairs[k].second;
+            continue;
+        }
+        uniqueIndices.push_back(pairs[k].first);
+        uniqueValues.push_back(pairs[k].second);
+    }
+    if (coalesce)
+    {
+        res.setVector(uniqueIndices.size(), &uniqueIndices[0],
+                &uniqueValues[0], false);
+        return;
+    }
+    // the order given is kept
+    res.setVector(size, indices, values, false);
+}
@@ -7,6 +7,8 @@
 
 #include <vector>
 
+class CoinPackedVector;
+
 typedef std::vector<double> Values;
 typedef std::vector<int> Indices;
 
@@ -20,4 +22,14 @@ struct indices_helper
     static const int get(Indices const& x, int i);
 };
 
+struct packed_helper
+{
+    // Replaces res with the size pairs (indices[k], values[k]), in one
+    // allocation. If coalesce, the pairs are sorted by index and the
+    // values of a repeated index are summed. Otherwise a repeated index
+    // throws, as CoinPackedVector::insert does. Negative indices throw.
+    static void build(const int * indices, const double * values, int size,
+            bool coalesce, CoinPackedVector &res);
+};
+
 #endif /* CARRAYS_HPP*/
@@ -0,0 +1,24 @@
+#include "Callbacks.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+void SparseBatch::append(const SparseBatch &other, int k)
+{
+    if (starts.empty())
+    {
+        starts.push_back(0);
+    }
+    for (int i = other.starts[k]; i < other.starts[k+1]; ++i)
+    {
+        indices.push_back(other.indices[i]);
+        values.push_back(other.values[i]);
+    }
+    starts.push_back(indices.size());
+    lower.push_back(other.lower[k]);
+    upper.push_back(other.upper[k]);
+    if (!other.objective.empty())
+    {
+        objective.push_back(other.objective[k]);
+    }
+}
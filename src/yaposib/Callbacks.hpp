@@ -0,0 +1,91 @@
+#ifndef CALLBACKS_HPP
+#define CALLBACKS_HPP
+
+/// @file:          Callbacks.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include "CArrays.hpp"
+
+// Progress report emitted while a branch and bound is running
+struct MipEvent
+{
+    // "incumbent" (new integer solution), "bound" (best possible value
+    // improved), "node" (periodic node count) or "finished"
+    std::string kind;
+
+    // Number of nodes explored so far (-1 if the solver does not say)
+    int nodes;
+
+    // Value of the best integer solution found so far
+    double objective;
+
+    // Best possible objective value
+    double bound;
+
+    // Relative gap between objective and bound (infinite as long as
+    // there is no integer solution)
+    double gap;
+
+    MipEvent() : nodes(-1), objective(0), bound(0), gap(0) {}
+};
+
+// Receives the MIP events synchronously, from inside the branch and
+// bound. Returning true asks the solver to stop as soon as possible.
+class MipEventListener
+{
+    public:
+        virtual ~MipEventListener(){}
+
+        virtual bool onEvent(const MipEvent &event) = 0;
+};
+
+// Rows (or columns) in compressed sparse form: the vector k is made of
+// the entries starts[k] to starts[k+1] (excluded) of indices and values,
+// and is bounded by lower[k] and upper[k].
+struct SparseBatch
+{
+    Indices starts;
+
+    Indices indices;
+
+    Values values;
+
+    Values lower;
+
+    Values upper;
+
+    // Objective coefficients (columns only, may be empty)
+    Values objective;
+
+    // Number of vectors in the batch
+    int size() const {return lower.size();}
+
+    // Appends a vector, read from another batch
+    void append(const SparseBatch &other, int k);
+};
+
+// Finds the rows violated by a solution (row generation)
+class RowSeparator
+{
+    public:
+        virtual ~RowSeparator(){}
+
+        // Fills rows with constraints violated by x (numCols values).
+        // x is only valid during the call.
+        virtual void separate(const double *x, int numCols, SparseBatch &rows) = 0;
+};
+
+// Finds columns that improve a solution (column generation)
+class ColumnPricer
+{
+    public:
+        virtual ~ColumnPricer(){}
+
+        // Fills cols with candidate columns, priced with the dual values
+        // (numRows values). duals is only valid during the call.
+        virtual void price(const double *duals, int numRows, SparseBatch &cols) = 0;
+};
+
+#endif /* CALLBACKS_HPP*/
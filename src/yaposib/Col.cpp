@@ -134,6 +134,11 @@ std::size_t Cols::size() const
     return _cols.size();
 }
 
+std::size_t Cols::memoryUsage() const
+{
+    return _cols.capacity() * sizeof(Col);
+}
+
 void Cols::update()
 {
     _cols.clear();
@@ -84,6 +84,9 @@ class Cols
 
         std::size_t size() const;
 
+        // Bytes held by the handles
+        std::size_t memoryUsage() const;
+
         void update();
 };
 
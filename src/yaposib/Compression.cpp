@@ -0,0 +1,431 @@
+#include "Compression.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+
+#ifdef Zlib
+#include <zlib.h>
+#endif
+#ifdef Bzip2
+#include <bzlib.h>
+#endif
+#ifdef Zstd
+#include <zstd.h>
+#endif
+
+// The libraries take their input and give their output by blocks of at
+// most that size (their counters are 32 bits)
+static const std::size_t MAX_BLOCK = 1 << 30;
+
+// Output buffers grow when less than that is left
+static const std::size_t MIN_ROOM = 1 << 16;
+
+// Room after the used bytes of out, which grows geometrically
+static std::size_t makeRoom(std::string &out, std::size_t used)
+{
+    if (out.size() - used < MIN_ROOM)
+    {
+        out.resize(std::max(2 * out.size(), used + 16 * MIN_ROOM));
+    }
+    return std::min(out.size() - used, MAX_BLOCK);
+}
+
+static bool endsWith(const std::string &name, const char * suffix)
+{
+    std::size_t size = std::strlen(suffix);
+    return name.size() >= size
+        && name.compare(name.size() - size, size, suffix) == 0;
+}
+
+#ifdef Zlib
+static void gunzip(const char * data, std::size_t size, std::string &out)
+{
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // 15 + 32: any window, gzip or zlib header
+    if (inflateInit2(&stream, 15 + 32) != Z_OK)
+    {
+        throw std::runtime_error("gzip: can not initialize zlib");
+    }
+    // the last 4 bytes give the size of the last member (modulo 2^32),
+    // deflate does not compress more than 1032 times
+    out.clear();
+    if (size >= 4)
+    {
+        const unsigned char * end =
+            reinterpret_cast< const unsigned char * >(data + size);
+        std::size_t hint = end[-4] | (end[-3] << 8) | (end[-2] << 16)
+            | (static_cast< std::size_t >(end[-1]) << 24);
+        out.resize(std::min(hint, 1032 * size));
+    }
+    std::size_t consumed = 0;
+    std::size_t used = 0;
+    std::string error;
+    while (true)
+    {
+        if (stream.avail_in == 0 && consumed < size)
+        {
+            std::size_t block = std::min(size - consumed, MAX_BLOCK);
+            stream.next_in = reinterpret_cast< Bytef * >(
+                    const_cast< char * >(data + consumed));
+            stream.avail_in = block;
+            consumed += block;
+        }
+        std::size_t room = makeRoom(out, used);
+        stream.next_out = reinterpret_cast< Bytef * >(&out[used]);
+        stream.avail_out = room;
+        int res = inflate(&stream, Z_NO_FLUSH);
+        used += room - stream.avail_out;
+        bool inputLeft = stream.avail_in > 0 || consumed < size;
+        if (res == Z_STREAM_END && !inputLeft)
+        {
+            break;
+        }
+        if (res == Z_STREAM_END)
+        {
+            // another member follows
+            inflateReset(&stream);
+        }
+        else if (res == Z_BUF_ERROR && !inputLeft)
+        {
+            error = "gzip: unexpected end of data";
+            break;
+        }
+        else if (res != Z_OK && res != Z_BUF_ERROR)
+        {
+            error = std::string("gzip: ")
+                + ((stream.msg != NULL) ? stream.msg : "corrupt data");
+            break;
+        }
+    }
+    inflateEnd(&stream);
+    if (!error.empty())
+    {
+        throw std::runtime_error(error);
+    }
+    out.resize(used);
+}
+
+static void gzip(const char * data, std::size_t size, std::string &out)
+{
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // 15 + 16: gzip header
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::runtime_error("gzip: can not initialize zlib");
+    }
+    out.clear();
+    std::size_t consumed = 0;
+    std::size_t used = 0;
+    int res = Z_OK;
+    while (res != Z_STREAM_END)
+    {
+        if (stream.avail_in == 0 && consumed < size)
+        {
+            std::size_t block = std::min(size - consumed, MAX_BLOCK);
+            stream.next_in = reinterpret_cast< Bytef * >(
+                    const_cast< char * >(data + consumed));
+            stream.avail_in = block;
+            consumed += block;
+        }
+        std::size_t room = makeRoom(out, used);
+        stream.next_out = reinterpret_cast< Bytef * >(&out[used]);
+        stream.avail_out = room;
+        res = deflate(&stream, (consumed == size) ? Z_FINISH : Z_NO_FLUSH);
+        used += room - stream.avail_out;
+        if (res != Z_OK && res != Z_BUF_ERROR && res != Z_STREAM_END)
+        {
+            deflateEnd(&stream);
+            throw std::runtime_error("gzip: compression failed");
+        }
+    }
+    deflateEnd(&stream);
+    out.resize(used);
+}
+#endif
+
+#ifdef Bzip2
+static void bunzip2(const char * data, std::size_t size, std::string &out)
+{
+    bz_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK)
+    {
+        throw std::runtime_error("bzip2: can not initialize libbz2");
+    }
+    out.clear();
+    std::size_t consumed = 0;
+    std::size_t used = 0;
+    std::string error;
+    while (true)
+    {
+        if (stream.avail_in == 0 && consumed < size)
+        {
+            std::size_t block = std::min(size - consumed, MAX_BLOCK);
+            stream.next_in = const_cast< char * >(data + consumed);
+            stream.avail_in = block;
+            consumed += block;
+        }
+        std::size_t room = makeRoom(out, used);
+        stream.next_out = &out[used];
+        stream.avail_out = room;
+        int res = BZ2_bzDecompress(&stream);
+        used += room - stream.avail_out;
+        bool inputLeft = stream.avail_in > 0 || consumed < size;
+        if (res == BZ_STREAM_END && !inputLeft)
+        {
+            break;
+        }
+        if (res == BZ_STREAM_END)
+        {
+            // another stream follows (as pbzip2 writes them)
+            char * next = stream.next_in;
+            unsigned int available = stream.avail_in;
+            BZ2_bzDecompressEnd(&stream);
+            std::memset(&stream, 0, sizeof(stream));
+            if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK)
+            {
+                // the previous stream is already ended
+                throw std::runtime_error("bzip2: can not initialize libbz2");
+            }
+            stream.next_in = next;
+            stream.avail_in = available;
+        }
+        else if (res == BZ_OK && !inputLeft && stream.avail_out > 0)
+        {
+            error = "bzip2: unexpected end of data";
+            break;
+        }
+        else if (res != BZ_OK)
+        {
+            error = "bzip2: corrupt data";
+            break;
+        }
+    }
+    BZ2_bzDecompressEnd(&stream);
+    if (!error.empty())
+    {
+        throw std::runtime_error(error);
+    }
+    out.resize(used);
+}
+
+static void bzip2(const char * data, std::size_t size, std::string &out)
+{
+    bz_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (BZ2_bzCompressInit(&stream, 9, 0, 0) != BZ_OK)
+    {
+        throw std::runtime_error("bzip2: can not initialize libbz2");
+    }
+    out.clear();
+    std::size_t consumed = 0;
+    std::size_t used = 0;
+    int res = BZ_RUN_OK;
+    while (res != BZ_STREAM_END)
+    {
+        if (stream.avail_in == 0 && consumed < size)
+        {
+            std::size_t block = std::min(size - consumed, MAX_BLOCK);
+            stream.next_in = const_cast< char * >(data + consumed);
+            stream.avail_in = block;
+            consumed += block;
+        }
+        std::size_t room = makeRoom(out, used);
+        stream.next_out = &out[used];
+        stream.avail_out = room;
+        res = BZ2_bzCompress(&stream, (consumed == size) ? BZ_FINISH : BZ_RUN);
+        used += room - stream.avail_out;
+        if (res != BZ_RUN_OK && res != BZ_FINISH_OK && res != BZ_STREAM_END)
+        {
+            BZ2_bzCompressEnd(&stream);
+            throw std::runtime_error("bzip2: compression failed");
+        }
+    }
+    BZ2_bzCompressEnd(&stream);
+    out.resize(used);
+}
+#endif
+
+#ifdef Zstd
+static void unzstd(const char * data, std::size_t size, std::string &out)
+{
+    ZSTD_DStream * stream = ZSTD_createDStream();
+    if (stream == NULL)
+    {
+        throw std::runtime_error("zstd: can not initialize libzstd");
+    }
+    ZSTD_initDStream(stream);
+    out.clear();
+    unsigned long long hint = ZSTD_getFrameContentSize(data, size);
+    if (hint != ZSTD_CONTENTSIZE_UNKNOWN && hint != ZSTD_CONTENTSIZE_ERROR)
+    {
+        out.resize(hint);
+    }
+    ZSTD_inBuffer input = {data, size, 0};
+    std::size_t used = 0;
+    std::string error;
+    while (true)
+    {
+        std::size_t room = makeRoom(out, used);
+        ZSTD_outBuffer output = {&out[used], room, 0};
+        std::size_t res = ZSTD_decompressStream(stream, &output, &input);
+        used += output.pos;
+        if (ZSTD_isError(res))
+        {
+            error = std::string("zstd: ") + ZSTD_getErrorName(res);
+            break;
+        }
+        // all the input is read, and the output is flushed
+        if (input.pos == input.size && output.pos < output.size)
+        {
+            if (res != 0)
+            {
+                error = "zstd: unexpected end of data";
+            }
+            break;
+        }
+    }
+    ZSTD_freeDStream(stream);
+    if (!error.empty())
+    {
+        throw std::runtime_error(error);
+    }
+    out.resize(used);
+}
+
+static void zstd(const char * data, std::size_t size, std::string &out)
+{
+    out.resize(ZSTD_compressBound(size));
+    std::size_t res = ZSTD_compress(&out[0], out.size(), data, size, 3);
+    if (ZSTD_isError(res))
+    {
+        throw std::runtime_error(std::string("zstd: ") + ZSTD_getErrorName(res));
+    }
+    out.resize(res);
+}
+#endif
+
+std::string Compression::formatOf(std::string filename)
+{
+    if (endsWith(filename, ".gz"))
+    {
+        return "gzip";
+    }
+    if (endsWith(filename, ".bz2"))
+    {
+        return "bzip2";
+    }
+    if (endsWith(filename, ".zst"))
+    {
+        return "zstd";
+    }
+    return "";
+}
+
+std::vector< std::string > Compression::available()
+{
+    std::vector< std::string > res;
+#ifdef Zlib
+    res.push_back("gzip");
+#endif
+#ifdef Bzip2
+    res.push_back("bzip2");
+#endif
+#ifdef Zstd
+    res.push_back("zstd");
+#endif
+    return res;
+}
+
+bool Compression::isAvailable(std::string format)
+{
+    std::vector< std::string > formats = available();
+    return std::find(formats.begin(), formats.end(), format) != formats.end();
+}
+
+void Compression::decompress(const char * data, std::size_t size,
+        std::string format, std::string &out)
+{
+#ifdef Zlib
+    if (format == "gzip")
+    {
+        gunzip(data, size, out);
+        return;
+    }
+#endif
+#ifdef Bzip2
+    if (format == "bzip2")
+    {
+        bunzip2(data, size, out);
+        return;
+    }
+#endif
+#ifdef Zstd
+    if (format == "zstd")
+    {
+        unzstd(data, size, out);
+        return;
+    }
+#endif
+    throw std::runtime_error("Compression " + format + " is not available");
+}
+
+void Compression::compress(const char * data, std::size_t size,
+        std::string format, std::string &out)
+{
+#ifdef Zlib
+    if (format == "gzip")
+    {
+        gzip(data, size, out);
+        return;
+    }
+#endif
+#ifdef Bzip2
+    if (format == "bzip2")
+    {
+        bzip2(data, size, out);
+        return;
+    }
+#endif
+#ifdef Zstd
+    if (format == "zstd")
+    {
+        zstd(data, size, out);
+        return;
+    }
+#endif
+    throw std::runtime_error("Compression " + format + " is not available");
+}
+
+void Compression::writeFile(std::string filename, const std::string &data)
+{
+    std::string format = formatOf(filename);
+    std::string compressed;
+    const std::string * content = &data;
+    if (!format.empty())
+    {
+        compress(data.data(), data.size(), format, compressed);
+        content = &compressed;
+    }
+    std::FILE * file = std::fopen(filename.c_str(), "wb");
+    if (file == NULL)
+    {
+        throw std::runtime_error("Can not open " + filename + ": "
+                + std::strerror(errno));
+    }
+    std::size_t written = std::fwrite(content->data(), 1, content->size(), file);
+    if (std::fclose(file) != 0 || written != content->size())
+    {
+        throw std::runtime_error("Can not write " + filename);
+    }
+}
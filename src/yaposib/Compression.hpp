@@ -0,0 +1,43 @@
+#ifndef COMPRESSION_HPP
+#define COMPRESSION_HPP
+
+/// @file:          Compression.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// Compressed model files, recognized by their extension: ".gz" (gzip),
+// ".bz2" (bzip2) and ".zst" (zstd). A format is only available if
+// yaposib was built with its library (see setup.py). Everything happens
+// in memory: there is no temporary file.
+class Compression
+{
+    public:
+        // "gzip", "bzip2" or "zstd" according to the extension of the
+        // file name, "" if it is not compressed
+        static std::string formatOf(std::string filename);
+
+        // The formats yaposib was built with
+        static std::vector< std::string > available();
+
+        // Was yaposib built with this format? ("": no)
+        static bool isAvailable(std::string format);
+
+        // Replaces out with the decompressed data. Concatenated streams
+        // are decompressed one after the other. Throws a runtime_error if
+        // the format is not available or the data is corrupt.
+        static void decompress(const char * data, std::size_t size,
+                std::string format, std::string &out);
+
+        // Replaces out with the compressed data
+        static void compress(const char * data, std::size_t size,
+                std::string format, std::string &out);
+
+        // Writes data to the file, compressed as its name says
+        static void writeFile(std::string filename, const std::string &data);
+};
+
+#endif /* COMPRESSION_HPP*/
@@ -0,0 +1,199 @@
+#include "Fingerprint.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cfloat>
+
+using boost::uint64_t;
+
+static const uint64_t C1 = UINT64_C(0x87c37b91114253d5);
+static const uint64_t C2 = UINT64_C(0x4cf5ad432745937f);
+
+// Doubles are normalized by chunks of that many values
+static const std::size_t CHUNK = 1024;
+
+static uint64_t rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t fmix(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= UINT64_C(0xff51afd7ed558ccd);
+    k ^= k >> 33;
+    k *= UINT64_C(0xc4ceb9fe1a85ec53);
+    k ^= k >> 33;
+    return k;
+}
+
+// Little endian, whatever the platform (compilers make it a single load
+// where they can)
+static uint64_t load(const unsigned char * p)
+{
+    uint64_t res = 0;
+    for (int b = 7; b >= 0; --b)
+    {
+        res = (res << 8) | p[b];
+    }
+    return res;
+}
+
+Fingerprint::Fingerprint() :
+    _h1(0), _h2(0), _length(0), _tailSize(0)
+{
+}
+
+void Fingerprint::block(const unsigned char * data)
+{
+    uint64_t k1 = load(data);
+    uint64_t k2 = load(data + 8);
+    k1 *= C1;
+    k1 = rotl(k1, 31);
+    k1 *= C2;
+    _h1 ^= k1;
+    _h1 = rotl(_h1, 27);
+    _h1 += _h2;
+    _h1 = _h1 * 5 + 0x52dce729;
+    k2 *= C2;
+    k2 = rotl(k2, 33);
+    k2 *= C1;
+    _h2 ^= k2;
+    _h2 = rotl(_h2, 31);
+    _h2 += _h1;
+    _h2 = _h2 * 5 + 0x38495ab5;
+}
+
+void Fingerprint::update(const void * data, std::size_t size)
+{
+    const unsigned char * bytes = static_cast< const unsigned char * >(data);
+    _length += size;
+    if (_tailSize > 0)
+    {
+        std::size_t taken = std::min(size, 16 - _tailSize);
+        std::memcpy(_tail + _tailSize, bytes, taken);
+        _tailSize += taken;
+        bytes += taken;
+        size -= taken;
+        if (_tailSize < 16)
+        {
+            return;
+        }
+        block(_tail);
+        _tailSize = 0;
+    }
+    for (; size >= 16; size -= 16, bytes += 16)
+    {
+        block(bytes);
+    }
+    std::memcpy(_tail, bytes, size);
+    _tailSize = size;
+}
+
+void Fingerprint::updateDoubles(const double * values, std::size_t size,
+        double infinity)
+{
+    double chunk[CHUNK];
+    for (std::size_t begin = 0; begin < size; begin += CHUNK)
+    {
+        std::size_t n = std::min(CHUNK, size - begin);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            double value = values[begin + k];
+            chunk[k] = (value >= infinity) ? DBL_MAX
+                : ((value <= -infinity) ? -DBL_MAX
+                        : ((value == 0) ? 0 : value));
+        }
+        // the bytes of the doubles, in little endian
+        unsigned char bytes[CHUNK * 8];
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &chunk[k], 8);
+            for (int b = 0; b < 8; ++b)
+            {
+                bytes[8 * k + b] = static_cast< unsigned char >(bits >> (8 * b));
+            }
+        }
+        update(bytes, 8 * n);
+    }
+}
+
+void Fingerprint::updateInt(boost::int64_t value)
+{
+    unsigned char bytes[8];
+    for (int b = 0; b < 8; ++b)
+    {
+        bytes[b] = static_cast< unsigned char >(
+                static_cast< uint64_t >(value) >> (8 * b));
+    }
+    update(bytes, 8);
+}
+
+void Fingerprint::updateInts(const int * values, std::size_t size)
+{
+    unsigned char bytes[CHUNK * 4];
+    for (std::size_t begin = 0; begin < size; begin += CHUNK)
+    {
+        std::size_t n = std::min(CHUNK, size - begin);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            boost::uint32_t bits = values[begin + k];
+            for (int b = 0; b < 4; ++b)
+            {
+                bytes[4 * k + b] = static_cast< unsigned char >(bits >> (8 * b));
+            }
+        }
+        update(bytes, 4 * n);
+    }
+}
+
+std::string Fingerprint::hexDigest() const
+{
+    uint64_t h1 = _h1;
+    uint64_t h2 = _h2;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    for (std::size_t b = _tailSize; b > 8; --b)
+    {
+        k2 = (k2 << 8) | _tail[b - 1];
+    }
+    for (std::size_t b = std::min< std::size_t >(_tailSize, 8); b > 0; --b)
+    {
+        k1 = (k1 << 8) | _tail[b - 1];
+    }
+    if (_tailSize > 8)
+    {
+        k2 *= C2;
+        k2 = rotl(k2, 33);
+        k2 *= C1;
+        h2 ^= k2;
+    }
+    if (_tailSize > 0)
+    {
+        k1 *= C1;
+        k1 = rotl(k1, 31);
+        k1 *= C2;
+        h1 ^= k1;
+    }
+    h1 ^= _length;
+    h2 ^= _length;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix(h1);
+    h2 = fmix(h2);
+    h1 += h2;
+    h2 += h1;
+    char buffer[33];
+    std::sprintf(buffer, "%08lx%08lx%08lx%08lx",
+            static_cast< unsigned long >(h1 >> 32),
+            static_cast< unsigned long >(h1 & 0xffffffff),
+            static_cast< unsigned long >(h2 >> 32),
+            static_cast< unsigned long >(h2 & 0xffffffff));
+    return buffer;
+}
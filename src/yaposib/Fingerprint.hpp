@@ -0,0 +1,51 @@
+#ifndef FINGERPRINT_HPP
+#define FINGERPRINT_HPP
+
+/// @file:          Fingerprint.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+
+// 128 bits hash of a stream of bytes (MurmurHash3, x64 128 bits variant),
+// fed by pieces. The result only depends on the bytes, not on how they
+// were cut, and is the same on every platform.
+class Fingerprint
+{
+    private:
+        boost::uint64_t _h1;
+
+        boost::uint64_t _h2;
+
+        // Bytes hashed so far
+        boost::uint64_t _length;
+
+        // Bytes waiting for a block of 16 to be complete
+        unsigned char _tail[16];
+
+        std::size_t _tailSize;
+
+        void block(const unsigned char * data);
+
+    public:
+        Fingerprint();
+
+        void update(const void * data, std::size_t size);
+
+        // Doubles are hashed by value: -0 as 0, and the infinite values
+        // (at least infinity) as +/-DBL_MAX
+        void updateDoubles(const double * values, std::size_t size,
+                double infinity);
+
+        void updateInt(boost::int64_t value);
+
+        // ints are hashed as 4 bytes, little endian
+        void updateInts(const int * values, std::size_t size);
+
+        // The hash of the bytes given so far, as 32 hexadecimal digits
+        std::string hexDigest() const;
+};
+
+#endif /* FINGERPRINT_HPP*/
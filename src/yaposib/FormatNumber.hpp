@@ -0,0 +1,26 @@
+#ifndef FORMATNUMBER_HPP
+#define FORMATNUMBER_HPP
+
+/// @file:          FormatNumber.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+// Appends the value to out with as many digits as needed to read it back
+// exactly: the shortest of %.15g and %.17g (the text writers call it once
+// per value, see parseNumber for the other way)
+inline void appendNumber(std::string &out, double value)
+{
+    char buffer[32];
+    std::sprintf(buffer, "%.15g", value);
+    if (std::strtod(buffer, NULL) != value)
+    {
+        std::sprintf(buffer, "%.17g", value);
+    }
+    out += buffer;
+}
+
+#endif /* FORMATNUMBER_HPP*/
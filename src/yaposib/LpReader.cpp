@@ -0,0 +1,718 @@
+#include "LpReader.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+
+// boost includes
+#include <boost/unordered_map.hpp>
+
+#include "ParseNumber.hpp"
+
+typedef boost::unordered_map< std::string, int > NameIndex;
+
+// Values beyond are infinite
+static const double LP_INFINITY = 1e30;
+
+enum TokenKind
+{
+    END_OF_DATA,
+    KEYWORD,
+    NAME,
+    LABEL, // a name followed by ':'
+    NUMBER,
+    OPERATOR,
+    SIGN
+};
+
+enum Keyword
+{
+    MINIMIZE,
+    MAXIMIZE,
+    SUBJECT_TO,
+    BOUNDS,
+    GENERALS,
+    BINARIES,
+    END,
+    UNSUPPORTED
+};
+
+// Keywords, the longest first. A space matches any number of blanks.
+static const struct
+{
+    const char * phrase;
+    Keyword keyword;
+} KEYWORDS[] = {
+    {"maximize", MAXIMIZE}, {"maximise", MAXIMIZE}, {"maximum", MAXIMIZE},
+    {"max", MAXIMIZE},
+    {"minimize", MINIMIZE}, {"minimise", MINIMIZE}, {"minimum", MINIMIZE},
+    {"min", MINIMIZE},
+    {"subject to", SUBJECT_TO}, {"such that", SUBJECT_TO},
+    {"s.t.", SUBJECT_TO}, {"st", SUBJECT_TO},
+    {"bounds", BOUNDS}, {"bound", BOUNDS},
+    {"generals", GENERALS}, {"general", GENERALS}, {"gen", GENERALS},
+    {"integers", GENERALS},
+    {"binaries", BINARIES}, {"binary", BINARIES}, {"bin", BINARIES},
+    {"semi-continuous", UNSUPPORTED}, {"semis", UNSUPPORTED},
+    {"semi", UNSUPPORTED}, {"sos", UNSUPPORTED},
+    {"end", END},
+    {NULL, END}
+};
+
+struct LpToken
+{
+    TokenKind kind;
+
+    // text of the token (in the data, not NUL terminated)
+    const char * begin;
+
+    std::size_t size;
+
+    // NUMBER: its value (+/-DBL_MAX if infinite). SIGN: +1 or -1.
+    double value;
+
+    // OPERATOR: -1 for <=, 0 for =, 1 for >=
+    int op;
+
+    Keyword keyword;
+
+    int line;
+
+    std::string str() const {return std::string(begin, size);}
+
+    // case insensitive comparison with a lower case word
+    bool is(const char * word) const
+    {
+        if (std::strlen(word) != size)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (std::tolower(begin[i]) != word[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static void fail(int line, const std::string &message)
+{
+    std::ostringstream error;
+    error << "LP line " << line << ": " << message;
+    throw ModelError(error.str());
+}
+
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static bool isNameChar(char c)
+{
+    return !isBlank(c) && c != '\n' && std::strchr(":+-<>=[]^*\\", c) == NULL;
+}
+
+// Splits the data in tokens, one at a time
+class LpLexer
+{
+    private:
+        const char * _p;
+
+        const char * _end;
+
+        int _line;
+
+        // is the next token the first of its line?
+        bool _lineStart;
+
+        LpToken _peeked;
+
+        bool _hasPeeked;
+
+        // Matches a keyword at _p, which must not be a label
+        bool matchKeyword(Keyword &keyword, const char * &after) const
+        {
+            for (int k = 0; KEYWORDS[k].phrase != NULL; ++k)
+            {
+                const char * q = _p;
+                const char * c = KEYWORDS[k].phrase;
+                for (; *c != '\0' && q < _end; ++c)
+                {
+                    if (*c == ' ')
+                    {
+                        if (!isBlank(*q))
+                        {
+                            break;
+                        }
+                        while (q < _end && isBlank(*q))
+                        {
+                            ++q;
+                        }
+                    }
+                    else if (std::tolower(*q) == *c)
+                    {
+                        ++q;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+                if (*c != '\0' || (q < _end && isNameChar(*q)))
+                {
+                    continue;
+                }
+                const char * r = q;
+                while (r < _end && isBlank(*r))
+                {
+                    ++r;
+                }
+                if (r < _end && *r == ':')
+                {
+                    return false;
+                }
+                keyword = KEYWORDS[k].keyword;
+                after = q;
+                return true;
+            }
+            return false;
+        }
+
+        LpToken scan()
+        {
+            // blanks, new lines, comments and (optional) products
+            while (_p < _end)
+            {
+                if (*_p == '\n')
+                {
+                    ++_line;
+                    _lineStart = true;
+                    ++_p;
+                }
+                else if (isBlank(*_p) || *_p == '*')
+                {
+                    ++_p;
+                }
+                else if (*_p == '\\')
+                {
+                    const char * newline = static_cast< const char * >(
+                            std::memchr(_p, '\n', _end - _p));
+                    _p = (newline == NULL) ? _end : newline;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            LpToken token;
+            token.kind = END_OF_DATA;
+            token.begin = _p;
+            token.size = 0;
+            token.value = 0;
+            token.op = 0;
+            token.keyword = END;
+            token.line = _line;
+            if (_p == _end)
+            {
+                return token;
+            }
+            bool lineStart = _lineStart;
+            _lineStart = false;
+            const char * after;
+            if (lineStart && matchKeyword(token.keyword, after))
+            {
+                token.kind = KEYWORD;
+                token.size = after - _p;
+                _p = after;
+                return token;
+            }
+            char c = *_p;
+            if (c == '<' || c == '>' || c == '=')
+            {
+                ++_p;
+                if (c == '=' && _p < _end && (*_p == '<' || *_p == '>'))
+                {
+                    c = *_p++;
+                }
+                else if (_p < _end && *_p == '=')
+                {
+                    ++_p;
+                }
+                token.kind = OPERATOR;
+                token.op = (c == '<') ? -1 : (c == '>') ? 1 : 0;
+                return token;
+            }
+            if (c == '+' || c == '-')
+            {
+                ++_p;
+                token.kind = SIGN;
+                token.value = (c == '-') ? -1 : 1;
+                return token;
+            }
+            if (c == '[' || c == '^')
+            {
+                fail(_line, "quadratic terms are not supported");
+            }
+            if (std::isdigit(c) || (c == '.' && _p + 1 < _end
+                        && std::isdigit(_p[1])))
+            {
+                return scanNumber(token);
+            }
+            while (_p < _end && isNameChar(*_p))
+            {
+                ++_p;
+            }
+            token.size = _p - token.begin;
+            if (token.size == 0)
+            {
+                fail(_line, std::string("unexpected '") + c + "'");
+            }
+            if (token.is("inf") || token.is("infinity"))
+            {
+                token.kind = NUMBER;
+                token.value = DBL_MAX;
+                return token;
+            }
+            token.kind = NAME;
+            const char * q = _p;
+            while (q < _end && isBlank(*q))
+            {
+                ++q;
+            }
+            if (q < _end && *q == ':')
+            {
+                token.kind = LABEL;
+                _p = q + 1;
+            }
+            return token;
+        }
+
+        LpToken scanNumber(LpToken &token)
+        {
+            while (_p < _end && (std::isdigit(*_p) || *_p == '.'))
+            {
+                ++_p;
+            }
+            // exponent, if digits follow
+            if (_p < _end && (*_p == 'e' || *_p == 'E'))
+            {
+                const char * q = _p + 1;
+                if (q < _end && (*q == '+' || *q == '-'))
+                {
+                    ++q;
+                }
+                if (q < _end && std::isdigit(*q))
+                {
+                    _p = q;
+                    while (_p < _end && std::isdigit(*_p))
+                    {
+                        ++_p;
+                    }
+                }
+            }
+            token.size = _p - token.begin;
+            if (!parseNumber(token.begin, _p, token.value))
+            {
+                fail(_line, "bad number " + token.str());
+            }
+            if (token.value >= LP_INFINITY)
+            {
+                token.value = DBL_MAX;
+            }
+            token.kind = NUMBER;
+            return token;
+        }
+
+    public:
+        LpLexer(const char * data, std::size_t size) :
+            _p(data),
+            _end(data + size),
+            _line(1),
+            _lineStart(true),
+            _hasPeeked(false)
+        {}
+
+        const LpToken &peek()
+        {
+            if (!_hasPeeked)
+            {
+                _peeked = scan();
+                _hasPeeked = true;
+            }
+            return _peeked;
+        }
+
+        LpToken next()
+        {
+            peek();
+            _hasPeeked = false;
+            return _peeked;
+        }
+};
+
+// Builds the model out of the tokens
+class LpParser
+{
+    private:
+        LpLexer _lexer;
+
+        ModelData &_model;
+
+        NameIndex _cols;
+
+        NameIndex _rows;
+
+        // Constraint entries, in the order of the rows
+        Indices _entryRows;
+
+        Indices _entryCols;
+
+        Values _entryValues;
+
+        // For each column, the last row it has an entry in, and the
+        // position of this entry (repeated terms are summed)
+        Indices _lastRow;
+
+        Indices _lastEntry;
+
+        // Index of the column, created when it is first met
+        int column(const LpToken &name)
+        {
+            std::string key = name.str();
+            NameIndex::const_iterator found = _cols.find(key);
+            if (found != _cols.end())
+            {
+                return found->second;
+            }
+            int col = _model.colNames.size();
+            _cols[key] = col;
+            _model.colNames.push_back(key);
+            _model.colLower.push_back(0);
+            _model.colUpper.push_back(DBL_MAX);
+            _model.objective.push_back(0);
+            _model.integer.push_back(0);
+            _lastRow.push_back(-1);
+            _lastEntry.push_back(0);
+            return col;
+        }
+
+        // row -1 is the objective
+        void addTerm(int row, int col, double value)
+        {
+            if (row < 0)
+            {
+                _model.objective[col] += value;
+            }
+            else if (_lastRow[col] == row)
+            {
+                _entryValues[_lastEntry[col]] += value;
+            }
+            else
+            {
+                _lastRow[col] = row;
+                _lastEntry[col] = _entryValues.size();
+                _entryRows.push_back(row);
+                _entryCols.push_back(col);
+                _entryValues.push_back(value);
+            }
+        }
+
+        // Adds the terms of a linear expression, multiplied by factor, to
+        // the row, and its constants to constant. Returns false if it has
+        // no variable.
+        bool parseExpression(int row, double factor, double &constant)
+        {
+            bool hasTerms = false;
+            while (true)
+            {
+                TokenKind kind = _lexer.peek().kind;
+                if (kind != SIGN && kind != NUMBER && kind != NAME)
+                {
+                    return hasTerms;
+                }
+                double sign = factor;
+                while (_lexer.peek().kind == SIGN)
+                {
+                    sign *= _lexer.next().value;
+                }
+                LpToken token = _lexer.next();
+                if (token.kind == NUMBER && _lexer.peek().kind == NAME)
+                {
+                    addTerm(row, column(_lexer.next()), sign * token.value);
+                    hasTerms = true;
+                }
+                else if (token.kind == NUMBER)
+                {
+                    constant += sign * token.value;
+                }
+                else if (token.kind == NAME)
+                {
+                    addTerm(row, column(token), sign);
+                    hasTerms = true;
+                }
+                else
+                {
+                    fail(token.line, "expected a term");
+                }
+            }
+        }
+
+        // A signed number
+        double parseConstant()
+        {
+            double sign = 1;
+            while (_lexer.peek().kind == SIGN)
+            {
+                sign *= _lexer.next().value;
+            }
+            LpToken token = _lexer.next();
+            if (token.kind != NUMBER)
+            {
+                fail(token.line, "expected a number");
+            }
+            return sign * token.value;
+        }
+
+        void parseObjective()
+        {
+            if (_lexer.peek().kind == LABEL)
+            {
+                _model.objName = _lexer.next().str();
+            }
+            double constant = 0;
+            parseExpression(-1, 1, constant);
+            // OSI subtracts the offset from the objective value
+            _model.objOffset = -constant;
+        }
+
+        // "[name:] expression op constant" or
+        // "[name:] constant op expression op constant"
+        void parseConstraint()
+        {
+            int row = _model.rowNames.size();
+            int line = _lexer.peek().line;
+            std::string name;
+            if (_lexer.peek().kind == LABEL)
+            {
+                name = _lexer.next().str();
+                if (_rows.find(name) != _rows.end())
+                {
+                    fail(line, "row " + name + " is defined twice");
+                }
+                _rows[name] = row;
+            }
+            else
+            {
+                // registered like the others, and distinct from them
+                std::ostringstream generated;
+                generated << "c" << row + 1;
+                name = generated.str();
+                while (_rows.find(name) != _rows.end())
+                {
+                    name += "_";
+                }
+                _rows[name] = row;
+            }
+            double constant = 0;
+            bool hasTerms = parseExpression(row, 1, constant);
+            LpToken op = _lexer.next();
+            if (op.kind != OPERATOR)
+            {
+                fail(op.line, "expected <=, >= or =");
+            }
+            double lower = -DBL_MAX;
+            double upper = DBL_MAX;
+            if (hasTerms)
+            {
+                double rhs = parseConstant() - constant;
+                lower = (op.op >= 0) ? rhs : -DBL_MAX;
+                upper = (op.op <= 0) ? rhs : DBL_MAX;
+            }
+            else
+            {
+                double left = constant;
+                constant = 0;
+                if (!parseExpression(row, 1, constant))
+                {
+                    fail(line, "constraint without variables");
+                }
+                LpToken op2 = _lexer.next();
+                if (op2.kind != OPERATOR || op2.op != op.op || op.op == 0)
+                {
+                    fail(op2.line, "expected a range: lower <= expression <= upper");
+                }
+                double right = parseConstant();
+                lower = ((op.op < 0) ? left : right) - constant;
+                upper = ((op.op < 0) ? right : left) - constant;
+            }
+            _model.rowNames.push_back(name);
+            _model.rowLower.push_back(lower);
+            _model.rowUpper.push_back(upper);
+        }
+
+        // col op value
+        void setBound(int col, int op, double value)
+        {
+            if (op >= 0)
+            {
+                _model.colLower[col] = value;
+            }
+            if (op <= 0)
+            {
+                _model.colUpper[col] = value;
+            }
+        }
+
+        // "x free", "x op constant", "constant op x [op constant]"
+        void parseBound()
+        {
+            const LpToken &first = _lexer.peek();
+            if (first.kind == NAME)
+            {
+                int col = column(_lexer.next());
+                LpToken token = _lexer.next();
+                if (token.kind == NAME && token.is("free"))
+                {
+                    _model.colLower[col] = -DBL_MAX;
+                    _model.colUpper[col] = DBL_MAX;
+                }
+                else if (token.kind == OPERATOR)
+                {
+                    setBound(col, token.op, parseConstant());
+                }
+                else
+                {
+                    fail(token.line, "expected <=, >=, = or free");
+                }
+                return;
+            }
+            if (first.kind != SIGN && first.kind != NUMBER)
+            {
+                fail(first.line, "expected a bound");
+            }
+            double value = parseConstant();
+            LpToken op = _lexer.next();
+            LpToken name = _lexer.next();
+            if (op.kind != OPERATOR || name.kind != NAME)
+            {
+                fail(op.line, "expected a bound");
+            }
+            int col = column(name);
+            setBound(col, -op.op, value);
+            if (_lexer.peek().kind == OPERATOR)
+            {
+                int op2 = _lexer.next().op;
+                setBound(col, op2, parseConstant());
+            }
+        }
+
+        void parseIntegers(bool binary)
+        {
+            LpToken token = _lexer.next();
+            if (token.kind != NAME)
+            {
+                fail(token.line, "expected a variable");
+            }
+            int col = column(token);
+            _model.integer[col] = 1;
+            if (binary)
+            {
+                _model.colLower[col] = 0;
+                _model.colUpper[col] = 1;
+            }
+        }
+
+        // Sorts the entries by column
+        void buildMatrix()
+        {
+            int numCols = _model.numCols();
+            _model.starts.assign(numCols + 1, 0);
+            for (std::size_t e = 0; e < _entryCols.size(); ++e)
+            {
+                ++_model.starts[_entryCols[e] + 1];
+            }
+            for (int j = 0; j < numCols; ++j)
+            {
+                _model.starts[j + 1] += _model.starts[j];
+            }
+            Indices next(_model.starts.begin(), _model.starts.end() - 1);
+            _model.indices.resize(_entryCols.size());
+            _model.values.resize(_entryCols.size());
+            for (std::size_t e = 0; e < _entryCols.size(); ++e)
+            {
+                int position = next[_entryCols[e]]++;
+                _model.indices[position] = _entryRows[e];
+                _model.values[position] = _entryValues[e];
+            }
+        }
+
+    public:
+        LpParser(const char * data, std::size_t size, ModelData &model) :
+            _lexer(data, size),
+            _model(model)
+        {}
+
+        void parse()
+        {
+            // -1: after the objective, where only keywords can come
+            int section = -1;
+            while (_lexer.peek().kind != END_OF_DATA)
+            {
+                if (_lexer.peek().kind == KEYWORD)
+                {
+                    LpToken keyword = _lexer.next();
+                    section = keyword.keyword;
+                    if (section == END)
+                    {
+                        break;
+                    }
+                    if (section == UNSUPPORTED)
+                    {
+                        fail(keyword.line, "section " + keyword.str()
+                                + " is not supported");
+                    }
+                    if (section == MINIMIZE || section == MAXIMIZE)
+                    {
+                        _model.maximize = (section == MAXIMIZE);
+                        parseObjective();
+                        section = -1;
+                    }
+                    continue;
+                }
+                switch (section)
+                {
+                    case SUBJECT_TO:
+                        parseConstraint();
+                        break;
+                    case BOUNDS:
+                        parseBound();
+                        break;
+                    case GENERALS:
+                        parseIntegers(false);
+                        break;
+                    case BINARIES:
+                        parseIntegers(true);
+                        break;
+                    default:
+                        fail(_lexer.peek().line, "expected a section");
+                }
+            }
+            buildMatrix();
+        }
+};
+
+void LpReader::read(const char * data, std::size_t size, ModelData &model)
+{
+    model = ModelData();
+    LpParser parser(data, size, model);
+    parser.parse();
+}
@@ -0,0 +1,26 @@
+#ifndef LPREADER_HPP
+#define LPREADER_HPP
+
+/// @file:          LpReader.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <cstddef>
+#include "ModelData.hpp"
+
+// Reads models in (CPLEX) LP format from memory, in a single pass: the
+// tokens point into the data, and each name is copied once when it is
+// first met. Supported sections: Minimize/Maximize (one linear objective,
+// optionally with a constant), Subject To (linear constraints, and
+// ranges written "lower <= expression <= upper"), Bounds, General,
+// Binary and End. Keywords must start their line.
+class LpReader
+{
+    public:
+        // Parses size bytes of data into model. Throws a runtime_error
+        // giving the line of the first error.
+        static void read(const char * data, std::size_t size,
+                ModelData &model);
+};
+
+#endif /* LPREADER_HPP*/
@@ -0,0 +1,59 @@
+#include "MappedFile.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+
+// system includes
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFile::MappedFile(std::string filename) :
+    _fd(-1),
+    _data(NULL),
+    _size(0)
+{
+    _fd = open(filename.c_str(), O_RDONLY);
+    if (_fd < 0)
+    {
+        throw std::runtime_error("Can not open " + filename + ": "
+                + std::strerror(errno));
+    }
+    struct stat status;
+    if (fstat(_fd, &status) != 0)
+    {
+        std::string error = std::strerror(errno);
+        close(_fd);
+        throw std::runtime_error("Can not stat " + filename + ": " + error);
+    }
+    _size = status.st_size;
+    if (_size == 0)
+    {
+        return;
+    }
+    void * data = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (data == MAP_FAILED)
+    {
+        std::string error = std::strerror(errno);
+        close(_fd);
+        throw std::runtime_error("Can not map " + filename + ": " + error);
+    }
+    // the readers go through the file once
+    madvise(data, _size, MADV_SEQUENTIAL);
+    _data = static_cast< const char * >(data);
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data != NULL)
+    {
+        munmap(const_cast< char * >(_data), _size);
+    }
+    close(_fd);
+}
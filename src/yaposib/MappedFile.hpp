@@ -0,0 +1,39 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+/// @file:          MappedFile.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <cstddef>
+
+// A file mapped read only in memory, for the time the object lives
+class MappedFile
+{
+    private:
+        int _fd;
+
+        const char * _data;
+
+        std::size_t _size;
+
+        // not copyable
+        MappedFile(const MappedFile &);
+        MappedFile &operator=(const MappedFile &);
+
+    public:
+        // Maps the whole file. Throws a runtime_error if it can not be
+        // opened or mapped.
+        MappedFile(std::string filename);
+
+        ~MappedFile();
+
+        // Content of the file (NULL if it is empty). It is not NUL
+        // terminated.
+        const char * data() const {return _data;}
+
+        std::size_t size() const {return _size;}
+};
+
+#endif /* MAPPEDFILE_HPP*/
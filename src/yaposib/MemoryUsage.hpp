@@ -0,0 +1,56 @@
+#ifndef MEMORYUSAGE_HPP
+#define MEMORYUSAGE_HPP
+
+/// @file:          MemoryUsage.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <cstddef>
+
+// Bytes held by a problem, part by part. They are computed from the sizes
+// the solver reports through OSI: the storage it really allocates may be
+// larger (extra capacity, strings, allocator overhead), and its private
+// data (factorization, hot start, presolve) is not counted.
+struct MemoryUsage
+{
+    // Column major copy of the matrix, gaps between the columns included
+    std::size_t matrixByCol;
+
+    // Row major copy of the matrix
+    std::size_t matrixByRow;
+
+    // Bounds, objective and integrality of the columns, bounds (and
+    // sense, rhs, range) of the rows
+    std::size_t bounds;
+
+    // Primal and dual values, reduced costs and row activities
+    std::size_t solution;
+
+    // Names of the rows and of the columns
+    std::size_t names;
+
+    // Basis the solver would warm start from (0 if never solved)
+    std::size_t warmStart;
+
+    // yaposib's Row and Col handles
+    std::size_t handles;
+
+    // MIP start and MIP events waiting to be polled
+    std::size_t mipData;
+
+    // Stored matrix entries that are not used (gaps left by deletions),
+    // in bytes, included in matrixByCol
+    std::size_t matrixGaps;
+
+    MemoryUsage() :
+        matrixByCol(0), matrixByRow(0), bounds(0), solution(0), names(0),
+        warmStart(0), handles(0), mipData(0), matrixGaps(0) {}
+
+    std::size_t total() const
+    {
+        return matrixByCol + matrixByRow + bounds + solution + names
+            + warmStart + handles + mipData;
+    }
+};
+
+#endif /* MEMORYUSAGE_HPP*/
@@ -0,0 +1,149 @@
+#include "Model.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+#include "Problem.hpp"
+
+// OSI includes
+#include <coin/OsiSolverInterface.hpp>
+
+// std includes
+#include <stdexcept>
+#include <algorithm>
+
+Model::Model(const Problem &problem)
+{
+    boost::shared_ptr< ModelData > data(new ModelData());
+    problem.getModel(*data);
+    _data = data;
+}
+
+const ModelData &Model::data() const
+{
+    return *_data;
+}
+
+boost::shared_ptr< const ModelData > Model::getShared() const
+{
+    return _data;
+}
+
+int Model::getNumRows() const
+{
+    return _data->numRows();
+}
+
+int Model::getNumCols() const
+{
+    return _data->numCols();
+}
+
+int Model::getNumElements() const
+{
+    return _data->values.size();
+}
+
+Scenario::Scenario(const Model &model) :
+    _model(model)
+{
+}
+
+const Model &Scenario::getModel() const
+{
+    return _model;
+}
+
+void Scenario::setColBounds(int index, double lower, double upper)
+{
+    if (index < 0 || index >= _model.getNumCols())
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    _colBounds[index] = std::make_pair(lower, upper);
+}
+
+void Scenario::setRowBounds(int index, double lower, double upper)
+{
+    if (index < 0 || index >= _model.getNumRows())
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    _rowBounds[index] = std::make_pair(lower, upper);
+}
+
+void Scenario::setObjCoef(int index, double value)
+{
+    if (index < 0 || index >= _model.getNumCols())
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    _objective[index] = value;
+}
+
+std::size_t Scenario::size() const
+{
+    return _colBounds.size() + _rowBounds.size() + _objective.size();
+}
+
+// The values of the model, with the ones of the scenario, and the
+// infinite values as the solver wants them
+static void merge(const Values &model,
+        const std::map< int, std::pair< double, double > > &changes,
+        bool first, double infinity, Values &res)
+{
+    res.assign(model.begin(), model.end());
+    std::map< int, std::pair< double, double > >::const_iterator it;
+    for (it = changes.begin(); it != changes.end(); ++it)
+    {
+        res[it->first] = first ? it->second.first : it->second.second;
+    }
+    for (std::size_t k = 0; k < res.size(); ++k)
+    {
+        res[k] = std::max(-infinity, std::min(infinity, res[k]));
+    }
+}
+
+void Scenario::apply(OsiSolverInterface &solver) const
+{
+    const ModelData &model = _model.data();
+    if (solver.getNumCols() != model.numCols()
+            || solver.getNumRows() != model.numRows())
+    {
+        throw std::runtime_error("The solver does not hold the model");
+    }
+    double infinity = solver.getInfinity();
+    if (model.numCols() > 0)
+    {
+        Values values;
+        merge(model.colLower, _colBounds, true, infinity, values);
+        solver.setColLower(&values[0]);
+        merge(model.colUpper, _colBounds, false, infinity, values);
+        solver.setColUpper(&values[0]);
+        Values objective(model.objective);
+        std::map< int, double >::const_iterator it;
+        for (it = _objective.begin(); it != _objective.end(); ++it)
+        {
+            objective[it->first] = it->second;
+        }
+        solver.setObjective(&objective[0]);
+    }
+
+    // OSI sets the row bounds from indices and (lower, upper) pairs
+    Values rowLower;
+    Values rowUpper;
+    merge(model.rowLower, _rowBounds, true, infinity, rowLower);
+    merge(model.rowUpper, _rowBounds, false, infinity, rowUpper);
+    Indices rows(rowLower.size());
+    Values bounds(2 * rowLower.size());
+    for (std::size_t i = 0; i < rowLower.size(); ++i)
+    {
+        rows[i] = i;
+        bounds[2 * i] = rowLower[i];
+        bounds[2 * i + 1] = rowUpper[i];
+    }
+    if (!rows.empty())
+    {
+        solver.setRowSetBounds(&rows[0], &rows[0] + rows.size(), &bounds[0]);
+    }
+}
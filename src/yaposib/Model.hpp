@@ -0,0 +1,73 @@
+#ifndef MODEL_HPP
+#define MODEL_HPP
+
+/// @file:          Model.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <map>
+#include <utility>
+#include <boost/shared_ptr.hpp>
+#include "ModelData.hpp"
+
+// forward declarations
+class OsiSolverInterface;
+class Problem;
+
+// An immutable model (matrix, bounds, objective, names), shared by the
+// copies of the handle and by the scenarios built on it. It is copied
+// once from a problem.
+class Model
+{
+    private:
+        boost::shared_ptr< const ModelData > _data;
+
+    public:
+        Model(const Problem &problem);
+
+        const ModelData &data() const;
+
+        boost::shared_ptr< const ModelData > getShared() const;
+
+        int getNumRows() const;
+
+        int getNumCols() const;
+
+        int getNumElements() const;
+};
+
+// A variant of a model that only differs by some bounds and objective
+// coefficients. The scenario only stores its differences, so that many of
+// them can be kept for one model. See Problem::loadScenario.
+class Scenario
+{
+    private:
+        Model _model;
+
+        std::map< int, std::pair< double, double > > _colBounds;
+
+        std::map< int, std::pair< double, double > > _rowBounds;
+
+        std::map< int, double > _objective;
+
+    public:
+        Scenario(const Model &model);
+
+        const Model &getModel() const;
+
+        void setColBounds(int index, double lower, double upper);
+
+        void setRowBounds(int index, double lower, double upper);
+
+        void setObjCoef(int index, double value);
+
+        // Number of values that differ from the model
+        std::size_t size() const;
+
+        // Gives the bounds and objective of the scenario to a solver that
+        // holds the matrix of its model. Every bound and objective
+        // coefficient is set, so that the previous scenario is undone.
+        void apply(OsiSolverInterface &solver) const;
+};
+
+#endif /* MODEL_HPP*/
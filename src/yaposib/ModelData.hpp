@@ -0,0 +1,67 @@
+#ifndef MODELDATA_HPP
+#define MODELDATA_HPP
+
+/// @file:          ModelData.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include <cfloat>
+#include <stdexcept>
+#include "CArrays.hpp"
+
+// Thrown by the readers on a malformed or invalid model (python sees a
+// YaposibError)
+struct ModelError : public std::runtime_error
+{
+    ModelError(const std::string &message) : std::runtime_error(message) {}
+};
+
+// A whole model, as the native readers build it before giving it to the
+// solver at once (see Problem::loadModel). Infinite bounds are +/-DBL_MAX.
+struct ModelData
+{
+    std::string name;
+
+    std::string objName;
+
+    bool maximize;
+
+    // Objective offset, with the meaning of OSI's OsiObjOffset (it is
+    // subtracted from the objective value)
+    double objOffset;
+
+    // Matrix, column major: the column j is made of the entries starts[j]
+    // to starts[j+1] (excluded) of indices (rows) and values
+    Indices starts;
+
+    Indices indices;
+
+    Values values;
+
+    Values colLower;
+
+    Values colUpper;
+
+    Values objective;
+
+    // 1 for the integer columns
+    std::vector<char> integer;
+
+    std::vector<std::string> colNames;
+
+    Values rowLower;
+
+    Values rowUpper;
+
+    std::vector<std::string> rowNames;
+
+    int numCols() const {return colLower.size();}
+
+    int numRows() const {return rowLower.size();}
+
+    ModelData() : maximize(false), objOffset(0) {}
+};
+
+#endif /* MODELDATA_HPP*/
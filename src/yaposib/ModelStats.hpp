@@ -0,0 +1,78 @@
+#ifndef MODELSTATS_HPP
+#define MODELSTATS_HPP
+
+/// @file:          ModelStats.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include "CArrays.hpp"
+
+// Sizes and numerics of a model, to choose scaling, presolve and
+// algorithm hints (see Problem::analyze). The ranges are over the
+// nonzero finite values, in absolute value (0 and 0 if there is none).
+struct ModelStats
+{
+    int numRows;
+
+    int numCols;
+
+    int numElements;
+
+    // Number of rows (columns) by number of nonzeros: the bucket 0
+    // counts the empty ones, the bucket k > 0 the ones with 2^(k-1) to
+    // 2^k - 1 nonzeros
+    Indices rowHistogram;
+
+    Indices colHistogram;
+
+    double minCoefficient;
+
+    double maxCoefficient;
+
+    double minObjective;
+
+    double maxObjective;
+
+    // Row bounds
+    double minRhs;
+
+    double maxRhs;
+
+    // Column bounds
+    double minBound;
+
+    double maxBound;
+
+    // Columns without bounds, with equal bounds, integer, and integer
+    // within [0, 1]
+    int numFreeCols;
+
+    int numFixedCols;
+
+    int numIntegerCols;
+
+    int numBinaryCols;
+
+    // Rows without bounds, and with equal bounds
+    int numFreeRows;
+
+    int numEqualityRows;
+
+    int numEmptyRows;
+
+    int numSingletonRows;
+
+    int numEmptyCols;
+
+    int numSingletonCols;
+
+    ModelStats() :
+        numRows(0), numCols(0), numElements(0), minCoefficient(0),
+        maxCoefficient(0), minObjective(0), maxObjective(0), minRhs(0),
+        maxRhs(0), minBound(0), maxBound(0), numFreeCols(0), numFixedCols(0),
+        numIntegerCols(0), numBinaryCols(0), numFreeRows(0),
+        numEqualityRows(0), numEmptyRows(0), numSingletonRows(0),
+        numEmptyCols(0), numSingletonCols(0) {}
+};
+
+#endif /* MODELSTATS_HPP*/
@@ -0,0 +1,506 @@
+#include "ModelWriter.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <set>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "FormatNumber.hpp"
+
+// Bounds at least that large are infinite (as the MPS format says)
+static const double INFINITE_BOUND = 1e30;
+
+// How many terms an LP line holds before it is broken
+static const int TERMS_PER_LINE = 8;
+
+// Words the LP readers take for keywords or numbers
+static const char * LP_RESERVED[] = {"maximize", "maximise", "maximum", "max",
+    "minimize", "minimise", "minimum", "min", "subject", "such", "st",
+    "s.t.", "bounds", "bound", "generals", "general", "gen", "integers",
+    "binaries", "binary", "bin", "semi-continuous", "semis", "semi", "sos",
+    "end", "free", "inf", "infinity", NULL};
+
+static bool isInfinite(double value)
+{
+    return std::fabs(value) >= INFINITE_BOUND;
+}
+
+// The value, or 1e30 for an infinite one
+static void appendValue(std::string &out, double value)
+{
+    if (isInfinite(value))
+    {
+        out += (value > 0) ? "1e+30" : "-1e+30";
+        return;
+    }
+    appendNumber(out, value);
+}
+
+static bool isMpsName(const std::string &name)
+{
+    if (name.empty())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < name.size(); ++i)
+    {
+        if (std::isspace(static_cast< unsigned char >(name[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isLpName(const std::string &name)
+{
+    if (name.empty() || std::isdigit(static_cast< unsigned char >(name[0]))
+            || name[0] == '.')
+    {
+        return false;
+    }
+    // "e1" would read as an exponent by some readers
+    if ((name[0] == 'e' || name[0] == 'E') && name.size() > 1
+            && std::isdigit(static_cast< unsigned char >(name[1])))
+    {
+        return false;
+    }
+    std::string lower;
+    for (std::size_t i = 0; i < name.size(); ++i)
+    {
+        unsigned char c = name[i];
+        if (std::isspace(c) || std::strchr(":+-<>=[]^*\\", c) != NULL)
+        {
+            return false;
+        }
+        lower += std::tolower(c);
+    }
+    for (const char ** word = LP_RESERVED; *word != NULL; ++word)
+    {
+        if (lower == *word)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whether the count names are all valid and distinct (and different
+// from reserved, if it is not empty)
+static bool keepNames(const std::vector< std::string > &names,
+        std::size_t count, bool (*isValid)(const std::string &),
+        const std::string &reserved)
+{
+    if (names.size() != count)
+    {
+        return false;
+    }
+    std::set< std::string > seen;
+    if (!reserved.empty())
+    {
+        seen.insert(reserved);
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!isValid(names[i]) || !seen.insert(names[i]).second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::vector< std::string > generatedNames(const char * prefix,
+        std::size_t count)
+{
+    std::vector< std::string > res(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        char buffer[32];
+        std::sprintf(buffer, "%s%lu", prefix, static_cast< unsigned long >(i));
+        res[i] = buffer;
+    }
+    return res;
+}
+
+void ModelWriter::writeMps(const ModelData &model, std::string &out)
+{
+    int numCols = model.numCols();
+    int numRows = model.numRows();
+    std::string objName = isMpsName(model.objName) ? model.objName : "OBJ";
+    std::vector< std::string > rowNames = model.rowNames;
+    if (!keepNames(rowNames, numRows, isMpsName, objName))
+    {
+        // the generated names can not meet "OBJ"
+        rowNames = generatedNames("R", numRows);
+        objName = "OBJ";
+    }
+    std::vector< std::string > colNames = model.colNames;
+    if (!keepNames(colNames, numCols, isMpsName, ""))
+    {
+        colNames = generatedNames("C", numCols);
+    }
+
+    out.clear();
+    out += "NAME";
+    if (isMpsName(model.name))
+    {
+        out += "          " + model.name;
+    }
+    out += "\n";
+    if (model.maximize)
+    {
+        out += "OBJSENSE\n    MAX\n";
+    }
+
+    // rows: a range is written as G with its width in RANGES, a free row
+    // (which N would drop) as G with an infinite right hand side
+    out += "ROWS\n N  " + objName + "\n";
+    Values rhs(numRows, 0);
+    Values ranges(numRows, 0);
+    for (int i = 0; i < numRows; ++i)
+    {
+        double lower = model.rowLower[i];
+        double upper = model.rowUpper[i];
+        const char * type;
+        if (lower == upper)
+        {
+            type = " E  ";
+            rhs[i] = lower;
+        }
+        else if (isInfinite(lower) && !isInfinite(upper))
+        {
+            type = " L  ";
+            rhs[i] = upper;
+        }
+        else
+        {
+            type = " G  ";
+            rhs[i] = isInfinite(lower) ? -INFINITE_BOUND : lower;
+            ranges[i] = isInfinite(upper) ? 0 : upper - lower;
+        }
+        out += type + rowNames[i] + "\n";
+    }
+
+    out += "COLUMNS\n";
+    bool inIntegers = false;
+    for (int j = 0; j < numCols; ++j)
+    {
+        if (bool(model.integer[j]) != inIntegers)
+        {
+            inIntegers = model.integer[j];
+            out += inIntegers ? "    MARKER  'MARKER'  'INTORG'\n"
+                : "    MARKER  'MARKER'  'INTEND'\n";
+        }
+        // an empty column still needs a line
+        bool written = false;
+        if (model.objective[j] != 0
+                || model.starts[j] == model.starts[j+1])
+        {
+            out += "    " + colNames[j] + "  " + objName + "  ";
+            appendValue(out, model.objective[j]);
+            out += "\n";
+            written = true;
+        }
+        for (int k = model.starts[j]; k < model.starts[j+1]; ++k)
+        {
+            if (model.values[k] == 0 && written)
+            {
+                continue;
+            }
+            out += "    " + colNames[j] + "  "
+                + rowNames[model.indices[k]] + "  ";
+            appendValue(out, model.values[k]);
+            out += "\n";
+            written = true;
+        }
+    }
+    if (inIntegers)
+    {
+        out += "    MARKER  'MARKER'  'INTEND'\n";
+    }
+
+    out += "RHS\n";
+    if (model.objOffset != 0)
+    {
+        out += "    RHS  " + objName + "  ";
+        appendValue(out, model.objOffset);
+        out += "\n";
+    }
+    for (int i = 0; i < numRows; ++i)
+    {
+        if (rhs[i] != 0)
+        {
+            out += "    RHS  " + rowNames[i] + "  ";
+            appendValue(out, rhs[i]);
+            out += "\n";
+        }
+    }
+
+    out += "RANGES\n";
+    for (int i = 0; i < numRows; ++i)
+    {
+        if (ranges[i] != 0)
+        {
+            out += "    RNG  " + rowNames[i] + "  ";
+            appendValue(out, ranges[i]);
+            out += "\n";
+        }
+    }
+
+    // UP comes before LO: a negative upper bound frees a zero lower bound
+    out += "BOUNDS\n";
+    for (int j = 0; j < numCols; ++j)
+    {
+        double lower = model.colLower[j];
+        double upper = model.colUpper[j];
+        const std::string &name = colNames[j];
+        if (lower == upper)
+        {
+            out += " FX BND  " + name + "  ";
+            appendValue(out, lower);
+            out += "\n";
+            continue;
+        }
+        if (isInfinite(lower) && isInfinite(upper))
+        {
+            out += " FR BND  " + name + "\n";
+            continue;
+        }
+        if (isInfinite(lower))
+        {
+            out += " MI BND  " + name + "\n";
+        }
+        if (!isInfinite(upper))
+        {
+            out += " UP BND  " + name + "  ";
+            appendValue(out, upper);
+            out += "\n";
+        }
+        if (!isInfinite(lower) && (lower != 0 || upper < 0))
+        {
+            out += " LO BND  " + name + "  ";
+            appendValue(out, lower);
+            out += "\n";
+        }
+        // some readers bound the integers by 1 by default
+        if (model.integer[j] && lower == 0 && isInfinite(upper))
+        {
+            out += " PL BND  " + name + "\n";
+        }
+    }
+    out += "ENDATA\n";
+}
+
+// Appends " + 3 x", or "3 x" for the first term
+static void appendTerm(std::string &out, double value,
+        const std::string &name, bool first)
+{
+    if (value < 0)
+    {
+        out += first ? "- " : " - ";
+        value = -value;
+    }
+    else if (!first)
+    {
+        out += " + ";
+    }
+    if (value != 1)
+    {
+        appendValue(out, value);
+        out += " ";
+    }
+    out += name;
+}
+
+static void appendBound(std::string &out, double value)
+{
+    if (isInfinite(value))
+    {
+        out += (value > 0) ? "inf" : "-inf";
+    }
+    else
+    {
+        appendValue(out, value);
+    }
+}
+
+void ModelWriter::writeLp(const ModelData &model, std::string &out)
+{
+    int numCols = model.numCols();
+    int numRows = model.numRows();
+    std::vector< std::string > rowNames = model.rowNames;
+    if (!keepNames(rowNames, numRows, isLpName, ""))
+    {
+        rowNames = generatedNames("r", numRows);
+    }
+    std::vector< std::string > colNames = model.colNames;
+    if (!keepNames(colNames, numCols, isLpName, ""))
+    {
+        colNames = generatedNames("x", numCols);
+    }
+    if (numRows > 0 && numCols == 0)
+    {
+        throw std::runtime_error("LP format: rows need at least a column");
+    }
+
+    out.clear();
+    if (!model.name.empty())
+    {
+        out += "\\ Problem name: " + model.name + "\n";
+    }
+    out += model.maximize ? "Maximize\n" : "Minimize\n";
+    out += " " + (isLpName(model.objName) ? model.objName : "obj") + ":";
+    // the zeros keep the order of the columns
+    for (int j = 0; j < numCols; ++j)
+    {
+        if (j == 0 || j % TERMS_PER_LINE == 0)
+        {
+            out += (j == 0) ? " " : "\n ";
+        }
+        appendTerm(out, model.objective[j], colNames[j], j == 0);
+    }
+    if (model.objOffset != 0)
+    {
+        // OSI subtracts the offset from the objective value
+        out += (model.objOffset > 0) ? " - " : " + ";
+        appendValue(out, std::fabs(model.objOffset));
+    }
+    out += "\n";
+
+    // the rows, from the columns
+    Indices rowStarts(numRows + 1, 0);
+    for (std::size_t k = 0; k < model.indices.size(); ++k)
+    {
+        ++rowStarts[model.indices[k] + 1];
+    }
+    for (int i = 0; i < numRows; ++i)
+    {
+        rowStarts[i+1] += rowStarts[i];
+    }
+    Indices rowCols(model.indices.size());
+    Values rowValues(model.indices.size());
+    Indices next(rowStarts.begin(), rowStarts.end() - 1);
+    for (int j = 0; j < numCols; ++j)
+    {
+        for (int k = model.starts[j]; k < model.starts[j+1]; ++k)
+        {
+            int position = next[model.indices[k]]++;
+            rowCols[position] = j;
+            rowValues[position] = model.values[k];
+        }
+    }
+
+    out += "Subject To\n";
+    for (int i = 0; i < numRows; ++i)
+    {
+        double lower = model.rowLower[i];
+        double upper = model.rowUpper[i];
+        bool range = !isInfinite(lower) && !isInfinite(upper)
+            && lower != upper;
+        out += " " + rowNames[i] + ": ";
+        if (range)
+        {
+            appendValue(out, lower);
+            out += " <= ";
+        }
+        if (rowStarts[i] == rowStarts[i+1])
+        {
+            out += "0 " + colNames[0];
+        }
+        for (int k = rowStarts[i]; k < rowStarts[i+1]; ++k)
+        {
+            int term = k - rowStarts[i];
+            if (term % TERMS_PER_LINE == 0 && term > 0)
+            {
+                out += "\n  ";
+            }
+            appendTerm(out, rowValues[k], colNames[rowCols[k]], term == 0);
+        }
+        if (range)
+        {
+            out += " <= ";
+            appendValue(out, upper);
+        }
+        else if (lower == upper)
+        {
+            out += " = ";
+            appendValue(out, lower);
+        }
+        else if (!isInfinite(upper))
+        {
+            out += " <= ";
+            appendValue(out, upper);
+        }
+        else
+        {
+            out += " >= ";
+            appendBound(out, lower);
+        }
+        out += "\n";
+    }
+
+    // [0, inf] is the default
+    out += "Bounds\n";
+    for (int j = 0; j < numCols; ++j)
+    {
+        double lower = model.colLower[j];
+        double upper = model.colUpper[j];
+        const std::string &name = colNames[j];
+        if (lower == upper)
+        {
+            out += " " + name + " = ";
+            appendValue(out, lower);
+        }
+        else if (isInfinite(lower) && isInfinite(upper))
+        {
+            out += " " + name + " free";
+        }
+        else if (isInfinite(upper))
+        {
+            if (lower == 0)
+            {
+                continue;
+            }
+            out += " " + name + " >= ";
+            appendValue(out, lower);
+        }
+        else if (lower == 0 && upper >= 0)
+        {
+            out += " " + name + " <= ";
+            appendValue(out, upper);
+        }
+        else
+        {
+            out += " ";
+            appendBound(out, lower);
+            out += " <= " + name + " <= ";
+            appendValue(out, upper);
+        }
+        out += "\n";
+    }
+
+    std::string generals;
+    int count = 0;
+    for (int j = 0; j < numCols; ++j)
+    {
+        if (model.integer[j])
+        {
+            generals += (count % TERMS_PER_LINE == 0) ? "\n " : " ";
+            generals += colNames[j];
+            ++count;
+        }
+    }
+    if (count > 0)
+    {
+        out += "Generals" + generals + "\n";
+    }
+    out += "End\n";
+}
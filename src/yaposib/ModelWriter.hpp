@@ -0,0 +1,29 @@
+#ifndef MODELWRITER_HPP
+#define MODELWRITER_HPP
+
+/// @file:          ModelWriter.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include "ModelData.hpp"
+
+// Writes models in memory, in the formats MpsReader and LpReader read
+// back (and so do the other readers). The names are kept when the format
+// allows them all, otherwise every row (or column) gets a generated name.
+// Numbers are written with as many digits as needed to read them back
+// exactly.
+class ModelWriter
+{
+    public:
+        // Replaces out with the model in free MPS format
+        static void writeMps(const ModelData &model, std::string &out);
+
+        // Replaces out with the model in (CPLEX) LP format. Every column
+        // appears in the objective, so that they are read back in the
+        // same order. Throws a runtime_error if a row can not be written
+        // (a row needs a column).
+        static void writeLp(const ModelData &model, std::string &out);
+};
+
+#endif /* MODELWRITER_HPP*/
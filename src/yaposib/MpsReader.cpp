@@ -0,0 +1,737 @@
+#include "MpsReader.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <cmath>
+#include <cfloat>
+
+// boost includes
+#include <boost/unordered_map.hpp>
+
+#include "ParseNumber.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+typedef boost::unordered_map< std::string, int > NameIndex;
+
+// Index given to the objective row, and to the other free rows (their
+// entries are dropped)
+static const int OBJECTIVE_ROW = -1;
+static const int FREE_ROW = -2;
+
+// Values beyond are infinite, as for CoinMpsIO
+static const double MPS_INFINITY = 1e30;
+
+// A line has at most that many fields
+static const int MAX_TOKENS = 8;
+
+// The COLUMNS section is not cut in chunks smaller than that (bytes)
+static const std::size_t MIN_CHUNK_SIZE = 1 << 16;
+
+enum Section
+{
+    DATA, // not a section header
+    UNSUPPORTED,
+    NAME,
+    OBJSENSE,
+    OBJNAME,
+    ROWS,
+    COLUMNS,
+    RHS,
+    RANGES,
+    BOUNDS,
+    ENDATA
+};
+
+// A field of a line (not NUL terminated)
+struct Token
+{
+    const char * begin;
+
+    std::size_t size;
+
+    std::string str() const {return std::string(begin, size);}
+
+    bool is(const char * word) const
+    {
+        return std::strlen(word) == size
+            && std::strncmp(begin, word, size) == 0;
+    }
+};
+
+// What a thread gets out of a piece of the COLUMNS section
+struct ColumnsChunk
+{
+    const char * begin;
+
+    const char * end;
+
+    // The columns starting in the chunk: name, first entry and integer
+    // marker (-1 if it depends on the previous chunks)
+    std::vector< std::string > names;
+
+    Indices firsts;
+
+    std::vector< int > markers;
+
+    // Integer marker at the end of the chunk (-1 if it has none)
+    int endMarker;
+
+    // Matrix entries
+    Indices rows;
+
+    Values values;
+
+    // Objective coefficients: column (in names) and value
+    Indices objColumns;
+
+    Values objValues;
+
+    int numLines;
+
+    // Line of the first error (counted from the start of the chunk)
+    int errorLine;
+
+    std::string error;
+
+    ColumnsChunk() :
+        begin(NULL), end(NULL), endMarker(-1), numLines(0), errorLine(0) {}
+};
+
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Start of the line after the one p is in
+static const char * nextLine(const char * p, const char * end)
+{
+    const char * newline =
+        static_cast< const char * >(std::memchr(p, '\n', end - p));
+    return (newline == NULL) ? end : newline + 1;
+}
+
+// Splits [begin, end) on blanks. Returns the number of fields, or
+// MAX_TOKENS + 1 if there are too many.
+static int tokenize(const char * begin, const char * end, Token * tokens)
+{
+    int count = 0;
+    const char * p = begin;
+    while (true)
+    {
+        while (p < end && isBlank(*p))
+        {
+            ++p;
+        }
+        if (p == end)
+        {
+            return count;
+        }
+        if (count == MAX_TOKENS)
+        {
+            return MAX_TOKENS + 1;
+        }
+        tokens[count].begin = p;
+        while (p < end && !isBlank(*p))
+        {
+            ++p;
+        }
+        tokens[count].size = p - tokens[count].begin;
+        ++count;
+    }
+}
+
+// False if the token is not a number
+static bool parseNumber(const Token &token, double &value)
+{
+    if (!parseNumber(token.begin, token.begin + token.size, value))
+    {
+        return false;
+    }
+    if (value >= MPS_INFINITY)
+    {
+        value = DBL_MAX;
+    }
+    else if (value <= -MPS_INFINITY)
+    {
+        value = -DBL_MAX;
+    }
+    return true;
+}
+
+static Section sectionOf(const Token &token)
+{
+    static const char * unsupported[] = {"SOS", "QUADOBJ", "QMATRIX",
+        "QSECTION", "QCMATRIX", "CSECTION", "INDICATORS", "USERCUTS",
+        "LAZYCONS", NULL};
+    if (token.is("NAME")) return NAME;
+    if (token.is("OBJSENSE") || token.is("OBJSENS")) return OBJSENSE;
+    if (token.is("OBJNAME")) return OBJNAME;
+    if (token.is("ROWS")) return ROWS;
+    if (token.is("COLUMNS")) return COLUMNS;
+    if (token.is("RHS")) return RHS;
+    if (token.is("RANGES")) return RANGES;
+    if (token.is("BOUNDS")) return BOUNDS;
+    if (token.is("ENDATA")) return ENDATA;
+    for (int i = 0; unsupported[i] != NULL; ++i)
+    {
+        if (token.is(unsupported[i]))
+        {
+            return UNSUPPORTED;
+        }
+    }
+    return DATA;
+}
+
+static void fail(int line, const std::string &message)
+{
+    std::ostringstream error;
+    error << "MPS line " << line << ": " << message;
+    throw ModelError(error.str());
+}
+
+// Looks a name up, fails if it is unknown
+static int lookup(const NameIndex &index, const Token &token, int line,
+        const char * what)
+{
+    NameIndex::const_iterator found = index.find(token.str());
+    if (found == index.end())
+    {
+        fail(line, std::string("unknown ") + what + " " + token.str());
+    }
+    return found->second;
+}
+
+static bool parseSense(const Token &token)
+{
+    return token.is("MAX") || token.is("MAXIMIZE");
+}
+
+// Parses a chunk of the COLUMNS section. Stops at the first error.
+static void parseChunk(ColumnsChunk &chunk, const NameIndex &rows)
+{
+    Token tokens[MAX_TOKENS];
+    std::string key;
+    int marker = -1;
+    // name of the current column
+    const char * current = NULL;
+    std::size_t currentSize = 0;
+    int line = 0;
+    for (const char * p = chunk.begin; p < chunk.end; )
+    {
+        const char * begin = p;
+        p = nextLine(p, chunk.end);
+        ++line;
+        if (*begin == '*')
+        {
+            continue;
+        }
+        int count = tokenize(begin, p, tokens);
+        if (count == 0)
+        {
+            continue;
+        }
+        if (count == 3 && tokens[1].is("'MARKER'"))
+        {
+            if (tokens[2].is("'INTORG'"))
+            {
+                marker = 1;
+            }
+            else if (tokens[2].is("'INTEND'"))
+            {
+                marker = 0;
+            }
+            else
+            {
+                chunk.errorLine = line;
+                chunk.error = "unknown marker " + tokens[2].str();
+                return;
+            }
+            continue;
+        }
+        if (count != 3 && count != 5)
+        {
+            chunk.errorLine = line;
+            chunk.error = "expected a column and one or two (row, value) pairs";
+            return;
+        }
+        if (current == NULL || tokens[0].size != currentSize
+                || std::memcmp(tokens[0].begin, current, currentSize) != 0)
+        {
+            current = tokens[0].begin;
+            currentSize = tokens[0].size;
+            chunk.names.push_back(tokens[0].str());
+            chunk.firsts.push_back(chunk.rows.size());
+            chunk.markers.push_back(marker);
+        }
+        int column = chunk.names.size() - 1;
+        for (int k = 1; k < count; k += 2)
+        {
+            key.assign(tokens[k].begin, tokens[k].size);
+            NameIndex::const_iterator row = rows.find(key);
+            double value;
+            if (row == rows.end())
+            {
+                chunk.errorLine = line;
+                chunk.error = "unknown row " + key;
+                return;
+            }
+            if (!parseNumber(tokens[k+1], value))
+            {
+                chunk.errorLine = line;
+                chunk.error = "bad number " + tokens[k+1].str();
+                return;
+            }
+            if (row->second >= 0)
+            {
+                chunk.rows.push_back(row->second);
+                chunk.values.push_back(value);
+            }
+            else if (row->second == OBJECTIVE_ROW)
+            {
+                chunk.objColumns.push_back(column);
+                chunk.objValues.push_back(value);
+            }
+        }
+    }
+    chunk.endMarker = marker;
+    chunk.numLines = line;
+}
+
+// Parses the COLUMNS section [begin, end), whose header is on the line
+// headerLine. Returns the number of lines of the section.
+static int readColumns(const char * begin, const char * end, int headerLine,
+        const NameIndex &rows, NameIndex &cols, ModelData &model,
+        int numThreads)
+{
+    std::size_t length = end - begin;
+    int numChunks = std::max(1, std::min(numThreads * 4,
+                static_cast< int >(length / MIN_CHUNK_SIZE)));
+    std::vector< ColumnsChunk > chunks(numChunks);
+    const char * p = begin;
+    for (int c = 0; c < numChunks; ++c)
+    {
+        chunks[c].begin = p;
+        const char * target = (c + 1 == numChunks) ?
+            end : begin + length * (c + 1) / numChunks;
+        p = std::max(p, target);
+        if (p > begin && p < end && p[-1] != '\n')
+        {
+            p = nextLine(p, end);
+        }
+        chunks[c].end = p;
+    }
+
+    #pragma omp parallel for schedule(dynamic) num_threads(numThreads)
+    for (int c = 0; c < numChunks; ++c)
+    {
+        try
+        {
+            parseChunk(chunks[c], rows);
+        }
+        catch (std::exception &e)
+        {
+            chunks[c].errorLine = 1;
+            chunks[c].error = e.what();
+        }
+    }
+
+    // number the columns, in the order of the file
+    int line = headerLine;
+    int marker = 0;
+    std::size_t numEntries = 0;
+    std::vector< std::size_t > offsets(numChunks);
+    for (int c = 0; c < numChunks; ++c)
+    {
+        ColumnsChunk &chunk = chunks[c];
+        if (!chunk.error.empty())
+        {
+            fail(line + chunk.errorLine, chunk.error);
+        }
+        offsets[c] = numEntries;
+        Indices columns(chunk.names.size());
+        for (std::size_t k = 0; k < chunk.names.size(); ++k)
+        {
+            if (k == 0 && !model.colNames.empty()
+                    && chunk.names[0] == model.colNames.back())
+            {
+                // the column goes on from the previous chunk
+                columns[0] = model.numCols() - 1;
+                continue;
+            }
+            if (cols.find(chunk.names[k]) != cols.end())
+            {
+                throw ModelError("MPS: the entries of column "
+                        + chunk.names[k] + " are not contiguous");
+            }
+            columns[k] = model.numCols();
+            cols[chunk.names[k]] = columns[k];
+            model.colNames.push_back(chunk.names[k]);
+            model.starts.push_back(numEntries + chunk.firsts[k]);
+            model.integer.push_back(chunk.markers[k] >= 0 ?
+                    chunk.markers[k] : marker);
+            model.colLower.push_back(0);
+            model.colUpper.push_back(DBL_MAX);
+            model.objective.push_back(0);
+        }
+        for (std::size_t i = 0; i < chunk.objColumns.size(); ++i)
+        {
+            model.objective[columns[chunk.objColumns[i]]] += chunk.objValues[i];
+        }
+        if (chunk.endMarker >= 0)
+        {
+            marker = chunk.endMarker;
+        }
+        numEntries += chunk.rows.size();
+        line += chunk.numLines;
+    }
+
+    // gather the entries
+    model.indices.resize(numEntries);
+    model.values.resize(numEntries);
+    #pragma omp parallel for num_threads(numThreads)
+    for (int c = 0; c < numChunks; ++c)
+    {
+        std::copy(chunks[c].rows.begin(), chunks[c].rows.end(),
+                model.indices.begin() + offsets[c]);
+        std::copy(chunks[c].values.begin(), chunks[c].values.end(),
+                model.values.begin() + offsets[c]);
+    }
+    return line - headerLine;
+}
+
+void MpsReader::read(const char * data, std::size_t size, ModelData &model,
+        int numThreads)
+{
+#ifdef _OPENMP
+    if (numThreads <= 0)
+    {
+        numThreads = omp_get_max_threads();
+    }
+#else
+    numThreads = 1;
+#endif
+    model = ModelData();
+    NameIndex rows;
+    NameIndex cols;
+    std::vector< char > rowTypes;
+    Values rhs;
+    Values ranges;
+    std::vector< char > hasRange;
+    std::string objRowName;
+    bool hasObjective = false;
+    // names of the sets in use
+    std::string rhsSet;
+    std::string rangesSet;
+    std::string boundsSet;
+
+    const char * end = data + size;
+    const char * p = data;
+    Token tokens[MAX_TOKENS];
+    Section section = DATA;
+    int line = 0;
+    bool finished = false;
+    while (p < end && !finished)
+    {
+        const char * begin = p;
+        p = nextLine(p, end);
+        ++line;
+        if (*begin == '*')
+        {
+            continue;
+        }
+        int count = tokenize(begin, p, tokens);
+        if (count == 0)
+        {
+            continue;
+        }
+        if (count > MAX_TOKENS)
+        {
+            fail(line, "too many fields");
+        }
+
+        // section headers start on the first column
+        Section header = isBlank(*begin) ? DATA : sectionOf(tokens[0]);
+        if (header == UNSUPPORTED)
+        {
+            fail(line, "section " + tokens[0].str() + " is not supported");
+        }
+        if (header != DATA)
+        {
+            section = header;
+            switch (header)
+            {
+                case NAME:
+                    model.name = (count > 1) ? tokens[1].str() : "";
+                    section = DATA;
+                    break;
+                case OBJSENSE:
+                    if (count > 1)
+                    {
+                        model.maximize = parseSense(tokens[1]);
+                        section = DATA;
+                    }
+                    break;
+                case OBJNAME:
+                    if (count > 1)
+                    {
+                        objRowName = tokens[1].str();
+                        section = DATA;
+                    }
+                    break;
+                case COLUMNS:
+                {
+                    // the section ends with the next header
+                    const char * columnsEnd = p;
+                    while (columnsEnd < end)
+                    {
+                        Token fields[MAX_TOKENS];
+                        if (!isBlank(*columnsEnd) && *columnsEnd != '*'
+                                && tokenize(columnsEnd,
+                                    nextLine(columnsEnd, end), fields) > 0
+                                && sectionOf(fields[0]) != DATA)
+                        {
+                            break;
+                        }
+                        columnsEnd = nextLine(columnsEnd, end);
+                    }
+                    line += readColumns(p, columnsEnd, line, rows, cols,
+                            model, numThreads);
+                    p = columnsEnd;
+                    section = DATA;
+                    break;
+                }
+                case ENDATA:
+                    finished = true;
+                    break;
+                default:
+                    break;
+            }
+            continue;
+        }
+
+        switch (section)
+        {
+            case OBJSENSE:
+                model.maximize = parseSense(tokens[0]);
+                break;
+            case OBJNAME:
+                objRowName = tokens[0].str();
+                break;
+            case ROWS:
+            {
+                if (count != 2 || tokens[0].size != 1)
+                {
+                    fail(line, "expected a row type and a row name");
+                }
+                std::string name = tokens[1].str();
+                if (rows.find(name) != rows.end())
+                {
+                    fail(line, "row " + name + " is defined twice");
+                }
+                char type = std::toupper(*tokens[0].begin);
+                if (type == 'N')
+                {
+                    if (!hasObjective
+                            && (objRowName.empty() || objRowName == name))
+                    {
+                        rows[name] = OBJECTIVE_ROW;
+                        model.objName = name;
+                        hasObjective = true;
+                    }
+                    else
+                    {
+                        rows[name] = FREE_ROW;
+                    }
+                }
+                else if (type == 'E' || type == 'L' || type == 'G')
+                {
+                    rows[name] = model.rowNames.size();
+                    model.rowNames.push_back(name);
+                    rowTypes.push_back(type);
+                    rhs.push_back(0);
+                    ranges.push_back(0);
+                    hasRange.push_back(0);
+                }
+                else
+                {
+                    fail(line, "unknown row type " + tokens[0].str());
+                }
+                break;
+            }
+            case RHS:
+            case RANGES:
+            {
+                if (count < 2 || count > 5)
+                {
+                    fail(line, "expected one or two (row, value) pairs");
+                }
+                // an odd number of fields starts with the name of the set
+                int first = count % 2;
+                if (first == 1)
+                {
+                    std::string &set = (section == RHS) ? rhsSet : rangesSet;
+                    if (set.empty())
+                    {
+                        set = tokens[0].str();
+                    }
+                    else if (!tokens[0].is(set.c_str()))
+                    {
+                        break;
+                    }
+                }
+                for (int k = first; k < count; k += 2)
+                {
+                    int row = lookup(rows, tokens[k], line, "row");
+                    double value;
+                    if (!parseNumber(tokens[k+1], value))
+                    {
+                        fail(line, "bad number " + tokens[k+1].str());
+                    }
+                    if (section == RHS && row == OBJECTIVE_ROW)
+                    {
+                        model.objOffset = value;
+                    }
+                    else if (section == RHS && row >= 0)
+                    {
+                        rhs[row] = value;
+                    }
+                    else if (row >= 0)
+                    {
+                        ranges[row] = value;
+                        hasRange[row] = 1;
+                    }
+                }
+                break;
+            }
+            case BOUNDS:
+            {
+                const Token &type = tokens[0];
+                bool hasValue = !(type.is("FR") || type.is("MI")
+                        || type.is("PL") || type.is("BV"));
+                // type, set, column, value
+                int first;
+                if (count == (hasValue ? 3 : 2))
+                {
+                    first = 1;
+                }
+                else if (count == (hasValue ? 4 : 3) || (!hasValue && count == 4))
+                {
+                    first = 2;
+                    if (boundsSet.empty())
+                    {
+                        boundsSet = tokens[1].str();
+                    }
+                    else if (!tokens[1].is(boundsSet.c_str()))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    fail(line, "expected a bound type, a column and a value");
+                }
+                int col = lookup(cols, tokens[first], line, "column");
+                double value = 0;
+                if (hasValue && !parseNumber(tokens[first+1], value))
+                {
+                    fail(line, "bad number " + tokens[first+1].str());
+                }
+                double &lower = model.colLower[col];
+                double &upper = model.colUpper[col];
+                if (type.is("UP") || type.is("UI"))
+                {
+                    // as CoinMpsIO, a negative upper bound frees the
+                    // default lower bound
+                    if (value < 0 && lower == 0)
+                    {
+                        lower = -DBL_MAX;
+                    }
+                    upper = value;
+                }
+                else if (type.is("LO") || type.is("LI"))
+                {
+                    lower = value;
+                }
+                else if (type.is("FX"))
+                {
+                    lower = value;
+                    upper = value;
+                }
+                else if (type.is("FR"))
+                {
+                    lower = -DBL_MAX;
+                    upper = DBL_MAX;
+                }
+                else if (type.is("MI"))
+                {
+                    lower = -DBL_MAX;
+                }
+                else if (type.is("PL"))
+                {
+                    upper = DBL_MAX;
+                }
+                else if (type.is("BV"))
+                {
+                    lower = 0;
+                    upper = 1;
+                }
+                else
+                {
+                    fail(line, "unsupported bound type " + type.str());
+                }
+                if (type.is("BV") || type.is("UI") || type.is("LI"))
+                {
+                    model.integer[col] = 1;
+                }
+                break;
+            }
+            default:
+                fail(line, "data outside of a section");
+        }
+    }
+    if (!finished)
+    {
+        fail(line, "ENDATA is missing");
+    }
+
+    // row bounds
+    for (std::size_t i = 0; i < rowTypes.size(); ++i)
+    {
+        double range = std::fabs(ranges[i]);
+        double lower = rhs[i];
+        double upper = rhs[i];
+        if (rowTypes[i] == 'E' && hasRange[i])
+        {
+            if (ranges[i] >= 0)
+            {
+                upper += range;
+            }
+            else
+            {
+                lower -= range;
+            }
+        }
+        else if (rowTypes[i] == 'L')
+        {
+            lower = hasRange[i] ? rhs[i] - range : -DBL_MAX;
+        }
+        else if (rowTypes[i] == 'G')
+        {
+            upper = hasRange[i] ? rhs[i] + range : DBL_MAX;
+        }
+        model.rowLower.push_back(lower);
+        model.rowUpper.push_back(upper);
+    }
+    model.starts.push_back(model.indices.size());
+}
@@ -0,0 +1,28 @@
+#ifndef MPSREADER_HPP
+#define MPSREADER_HPP
+
+/// @file:          MpsReader.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <cstddef>
+#include "ModelData.hpp"
+
+// Reads models in MPS format (fixed or free) from memory. Names can not
+// contain spaces. Supported sections: NAME, OBJSENSE, OBJNAME, ROWS,
+// COLUMNS (with integer markers), RHS, RANGES, BOUNDS and ENDATA. Only
+// the first RHS, RANGES and BOUNDS sets are used.
+//
+// The COLUMNS section, by far the largest, is cut in chunks parsed in
+// parallel.
+class MpsReader
+{
+    public:
+        // Parses size bytes of data into model. Throws a runtime_error
+        // giving the line of the first error. numThreads <= 0 means as
+        // many as OpenMP wants.
+        static void read(const char * data, std::size_t size,
+                ModelData &model, int numThreads);
+};
+
+#endif /* MPSREADER_HPP*/
@@ -0,0 +1,95 @@
+#ifndef PARSENUMBER_HPP
+#define PARSENUMBER_HPP
+
+/// @file:          ParseNumber.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// Parses the whole of [begin, end) as a number (the text readers call
+// it once per value). Decimals with at most 15 significant digits and a
+// small exponent are computed exactly without strtod, the others go
+// through strtod. Returns false if it is not a number (NaN included).
+inline bool parseNumber(const char * begin, const char * end, double &value)
+{
+    static const double POWERS[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+        1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+        1e19, 1e20, 1e21, 1e22};
+    const char * p = begin;
+    bool negative = (p < end && *p == '-');
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        ++p;
+    }
+    double mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool fast = true;
+    bool hasDigits = false;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p)
+    {
+        hasDigits = true;
+        if (mantissa != 0 || *p != '0')
+        {
+            ++digits;
+        }
+        mantissa = mantissa * 10 + (*p - '0');
+        fast = fast && digits <= 15;
+    }
+    if (p < end && *p == '.')
+    {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p)
+        {
+            hasDigits = true;
+            if (mantissa != 0 || *p != '0')
+            {
+                ++digits;
+            }
+            mantissa = mantissa * 10 + (*p - '0');
+            --exponent;
+            fast = fast && digits <= 15;
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        bool negativeExponent = (p < end && *p == '-');
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            ++p;
+        }
+        int e = 0;
+        const char * exponentStart = p;
+        for (; p < end && *p >= '0' && *p <= '9' && e < 10000; ++p)
+        {
+            e = e * 10 + (*p - '0');
+        }
+        fast = fast && p > exponentStart;
+        exponent += negativeExponent ? -e : e;
+    }
+    if (fast && hasDigits && p == end && exponent >= -22 && exponent <= 22)
+    {
+        value = mantissa;
+        value = (exponent < 0) ? value / POWERS[-exponent]
+            : value * POWERS[exponent];
+        value = negative ? -value : value;
+        return true;
+    }
+    // the rest (long mantissas, large exponents, inf, nan...)
+    char buffer[64];
+    std::size_t size = end - begin;
+    if (size == 0 || size >= sizeof(buffer))
+    {
+        return false;
+    }
+    std::memcpy(buffer, begin, size);
+    buffer[size] = '\0';
+    char * last;
+    value = std::strtod(buffer, &last);
+    return last == buffer + size && value == value;
+}
+
+#endif /* PARSENUMBER_HPP*/
@@ -1,4 +1,12 @@
 #include "Problem.hpp"
+#include "Compression.hpp"
+#include "Fingerprint.hpp"
+#include "LpReader.hpp"
+#include "MappedFile.hpp"
+#include "Model.hpp"
+#include "ModelWriter.hpp"
+#include "MpsReader.hpp"
+#include "SolutionFile.hpp"
 
 /// @author Christophe-Marie Duquesne <chmd@chmd.fr>
 /// created the 2010-07-21
@@ -7,153 +15,251 @@
 #include <coin/OsiSolverInterface.hpp>
 #ifdef Cbc
 #include <coin/OsiCbcSolverInterface.hpp>
-#endif
-#ifdef Clp
-#include <coin/OsiClpSolverInterface.hpp>
+#include <coin/CbcModel.hpp>
+#include <coin/CbcEventHandler.hpp>
 #endif
 #ifdef Cpx
 #include <coin/OsiCpxSolverInterface.hpp>
-#endif
-#ifdef Dylp
-#include <coin/OsiDylpSolverInterface.hpp>
-#endif
-#ifdef Fmp
-#include <coin/OsiFmpSolverInterface.hpp>
-#endif
-#ifdef Glpk
-#include <coin/OsiGlpkSolverInterface.hpp>
+#include <cplex.h>
 #endif
 #ifdef Grb
 #include <coin/OsiGrbSolverInterface.hpp>
-#endif
-#ifdef Msk
-#include <coin/OsiMskSolverInterface.hpp>
-#endif
-#ifdef Osl
-#include <coin/OsiOslSolverInterface.hpp>
-#endif
-#ifdef Spx
-#include <coin/OsiSpxSolverInterface.hpp>
-#endif
-#ifdef Sym
-#include <coin/OsiSymSolverInterface.hpp>
-#endif
-#ifdef Vol
-#include <coin/OsiVolSolverInterface.hpp>
-#endif
-#ifdef Xpr
-#include <coin/OsiXprSolverInterface.hpp>
+#include <gurobi_c.h>
 #endif
 #include <coin/CoinPackedVector.hpp>
 #include <coin/CoinShallowPackedVector.hpp>
 #include <coin/CoinPackedMatrix.hpp>
+#include <coin/CoinWarmStartBasis.hpp>
+#include <coin/CoinTime.hpp>
 
 // std includes
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
+#include <limits>
+#include <cmath>
+#include <sstream>
+#include <cstring>
+#include <cfloat>
 
-Problem::Problem(std::string solverName) :
-    _hasHotStart(false),
-    _hasBeenSolved(false)
+// system includes
+#include <sys/resource.h>
+#include <time.h>
+
+// Number of MIP events kept while nobody polls them
+static const std::size_t MAX_PENDING_MIP_EVENTS = 4096;
+
+// Statuses of a cached result, as bits (see CachedSolution)
+static const unsigned int CACHED_ABANDONED = 1;
+static const unsigned int CACHED_OPTIMAL = 2;
+static const unsigned int CACHED_PRIMAL_INFEASIBLE = 4;
+static const unsigned int CACHED_DUAL_INFEASIBLE = 8;
+static const unsigned int CACHED_PRIMAL_LIMIT = 16;
+static const unsigned int CACHED_DUAL_LIMIT = 32;
+static const unsigned int CACHED_ITERATION_LIMIT = 64;
+
+// The parts of a fingerprint, in the order they are combined
+static const char * FINGERPRINT_PARTS[] = {"structure", "coefficients",
+    "bounds", "objective"};
+
+static const int NUM_FINGERPRINT_PARTS = 4;
+
+// Matrices with less entries are copied by a single thread
+static const int PARALLEL_COPY_MIN = 1 << 20;
+
+// Matrices with less entries are multiplied by a single thread
+static const int PARALLEL_PRODUCT_MIN = 1 << 16;
+
+// Relative gap between an integer solution and the best possible value
+static double relativeGap(double objective, double bound)
 {
-#ifdef Cbc
-    if (solverName == "Cbc")
-    {
-        _solver = SolverPtr(new OsiCbcSolverInterface());
-    }
-#endif
-#ifdef Clp
-    if (solverName == "Clp")
-    {
-        _solver = SolverPtr(new OsiClpSolverInterface());
-    }
-#endif
-#ifdef Cpx
-    if (solverName == "Cpx")
-    {
-        _solver = SolverPtr(new OsiCpxSolverInterface());
-    }
-#endif
-#ifdef Dylp
-    if (solverName == "Dylp")
-    {
-        _solver = SolverPtr(new OsiDylpSolverInterface());
-    }
-#endif
-#ifdef Fmp
-    if (solverName == "Fmp")
-    {
-        _solver = SolverPtr(new OsiFmpSolverInterface());
-    }
-#endif
-#ifdef Glpk
-    if (solverName == "Glpk")
-    {
-        _solver = SolverPtr(new OsiGlpkSolverInterface());
-    }
-#endif
-#ifdef Grb
-    if (solverName == "Grb")
-    {
-        _solver = SolverPtr(new OsiGrbSolverInterface());
-    }
-#endif
-#ifdef Msk
-    if (solverName == "Msk")
+    return std::fabs(objective - bound)
+        / std::max(1e-10, std::fabs(objective));
+}
+
+// CPU time of the calling thread, in seconds, so that problems solved
+// in parallel (Benders, BatchSolver) do not count each other's time
+static double threadCpuTime()
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec now;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) == 0)
     {
-        _solver = SolverPtr(new OsiMskSolverInterface());
+        return now.tv_sec + now.tv_nsec * 1e-9;
     }
 #endif
-#ifdef Osl
-    if (solverName == "Osl")
+    return CoinCpuTime();
+}
+
+// Peak resident set size of the process, in kilobytes (0 if unknown)
+static long peakResidentSetSize()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
     {
-        _solver = SolverPtr(new OsiOslSolverInterface());
+        return 0;
     }
-#endif
-#ifdef Spx
-    if (solverName == "Spx")
+    return usage.ru_maxrss;
+}
+
+// Throws if the batch is malformed or refers to an index >= maxIndex
+static void checkBatch(const SparseBatch &batch, int maxIndex,
+        const char * outOfRange)
+{
+    std::size_t size = batch.size();
+    if (size == 0)
     {
-        _solver = SolverPtr(new OsiSpxSolverInterface());
+        return;
     }
-#endif
-#ifdef Sym
-    if (solverName == "Sym")
+    if (batch.upper.size() != size
+            || (!batch.objective.empty() && batch.objective.size() != size)
+            || batch.starts.size() != size + 1
+            || batch.values.size() != batch.indices.size()
+            || batch.starts[0] != 0
+            || batch.starts[size] != (int)batch.indices.size())
     {
-        _solver = SolverPtr(new OsiSymSolverInterface());
+        throw std::runtime_error("Malformed sparse vectors");
     }
-#endif
-#ifdef Vol
-    if (solverName == "Vol")
+    for (std::size_t k = 0; k < size; ++k)
     {
-        _solver = SolverPtr(new OsiVolSolverInterface());
+        if (batch.starts[k + 1] < batch.starts[k])
+        {
+            throw std::runtime_error("Malformed sparse vectors");
+        }
     }
-#endif
-#ifdef Xpr
-    if (solverName == "Xpr")
+    for (std::size_t i = 0; i < batch.indices.size(); ++i)
     {
-        _solver = SolverPtr(new OsiXprSolverInterface());
+        if (batch.indices[i] < 0 || batch.indices[i] >= maxIndex)
+        {
+            throw std::runtime_error(outOfRange);
+        }
     }
+}
+
+// Address of the first element, or NULL if the vector is empty
+template <class T>
+static const T * first(const std::vector<T> &v)
+{
+    return v.empty() ? NULL : &v[0];
+}
+
+#ifdef Cbc
+// Forwards the progress of Cbc's branch and bound to the problem
+class ProblemEventHandler : public CbcEventHandler
+{
+    private:
+        Problem *_problem;
+
+        // A "node" event is reported every _interval nodes
+        int _interval;
+
+        // Node count when the last "node" event was reported
+        int _lastNodes;
+
+        // Best possible value when the last "bound" event was reported
+        double _lastBound;
+
+        bool _hasBound;
+
+    public:
+        ProblemEventHandler(Problem *problem, int interval) :
+            CbcEventHandler(),
+            _problem(problem),
+            _interval(interval),
+            _lastNodes(0),
+            _lastBound(0),
+            _hasBound(false)
+        {}
+
+        ProblemEventHandler(const ProblemEventHandler &tocopy) :
+            CbcEventHandler(tocopy),
+            _problem(tocopy._problem),
+            _interval(tocopy._interval),
+            _lastNodes(tocopy._lastNodes),
+            _lastBound(tocopy._lastBound),
+            _hasBound(tocopy._hasBound)
+        {}
+
+        virtual CbcEventHandler * clone() const
+        {
+            return new ProblemEventHandler(*this);
+        }
+
+        virtual CbcAction event(CbcEvent whichEvent)
+        {
+            MipEvent event;
+            event.nodes = model_->getNodeCount();
+            event.objective = model_->getObjValue();
+            event.bound = model_->getBestPossibleObjValue();
+            event.gap = std::numeric_limits<double>::infinity();
+            if (model_->getSolutionCount() > 0)
+            {
+                event.gap = relativeGap(event.objective, event.bound);
+            }
+            bool stop = false;
+            if (whichEvent == solution || whichEvent == heuristicSolution)
+            {
+                event.kind = "incumbent";
+                stop = _problem->reportMipEvent(event);
+            }
+            else if (whichEvent == node)
+            {
+                double sense = model_->solver()->getObjSense();
+                if (!_hasBound || (event.bound - _lastBound) * sense > 1e-9)
+                {
+                    _hasBound = true;
+                    _lastBound = event.bound;
+                    event.kind = "bound";
+                    stop = _problem->reportMipEvent(event) || stop;
+                }
+                if (event.nodes - _lastNodes >= _interval)
+                {
+                    _lastNodes = event.nodes;
+                    event.kind = "node";
+                    stop = _problem->reportMipEvent(event) || stop;
+                }
+            }
+            return stop ? CbcEventHandler::stop : noAction;
+        }
+};
 #endif
-    if (_solver == NULL)
-    {
-        throw std::runtime_error( solverName + ": Unknown _solver");
-    }
-    else
-    {
-        // set names correctly
-        _solver->setIntParam(OsiNameDiscipline, 2);
-        setMaximize(false);
-        _rows = Rows(this);
-        _cols = Cols(this);
-        _obj  = Obj (this);
-    }
+
+Problem::Problem(std::string solverName) :
+    _solverName(solverName),
+    _hasHotStart(false),
+    _hasBeenSolved(false),
+    _mipEventInterval(100),
+    _mipGapLimit(-1),
+    _autoCompactRatio(-1),
+    _lastSolveEnd(CoinWallclockTime())
+{
+    _solver = SolverPool::acquire(solverName);
+    // set names correctly
+    _solver->setIntParam(OsiNameDiscipline, 2);
+    _solver->getStrParam(OsiProbName, _defaultProbName);
+    setMaximize(false);
+    _rows = Rows(this);
+    _cols = Cols(this);
+    _obj  = Obj (this);
 }
 
 Problem::Problem(const Problem &tocopy)
 {
+    _solverName    = tocopy._solverName;
     _hasHotStart   = tocopy._hasHotStart;
     _hasBeenSolved = tocopy._hasBeenSolved;
+    _mipListener      = tocopy._mipListener;
+    _mipEventInterval = tocopy._mipEventInterval;
+    _mipGapLimit      = tocopy._mipGapLimit;
+    _autoCompactRatio = tocopy._autoCompactRatio;
+    _sharedModel      = tocopy._sharedModel;
+    _solutionCache    = tocopy._solutionCache;
+    _cachedSolution   = tocopy._cachedSolution;
+    _mipStartIndices  = tocopy._mipStartIndices;
+    _mipStartValues   = tocopy._mipStartValues;
+    _stats            = tocopy._stats;
+    _lastSolveEnd     = tocopy._lastSolveEnd;
+    _defaultProbName  = tocopy._defaultProbName;
     _rows          = Rows(this);
     _cols          = Cols(this);
     _obj           = Obj (this);
@@ -245,6 +351,8 @@ double Problem::getObjOffset() const
 
 void Problem::setObjOffset(double d)
 {
+    // not restored by the scenarios
+    _sharedModel.reset();
     _solver->setDblParam(OsiObjOffset, d);
 }
 
@@ -344,39 +452,135 @@ double Problem::getIntegerTolerance() const
 
 bool Problem::isAbandoned() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_ABANDONED) != 0;
+    }
     return _solver->isAbandoned();
 }
 
 bool Problem::isProvenOptimal() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_OPTIMAL) != 0;
+    }
     return _solver->isProvenOptimal();
 }
 
 bool Problem::isProvenPrimalInfeasible() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_PRIMAL_INFEASIBLE) != 0;
+    }
     return _solver->isProvenPrimalInfeasible();
 }
 
 bool Problem::isProvenDualInfeasible() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_DUAL_INFEASIBLE) != 0;
+    }
     return _solver->isProvenDualInfeasible();
 }
 
 bool Problem::isPrimalObjectiveLimitReached() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_PRIMAL_LIMIT) != 0;
+    }
     return _solver->isPrimalObjectiveLimitReached();
 }
 
 bool Problem::isDualObjectiveLimitReached() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_DUAL_LIMIT) != 0;
+    }
     return _solver->isDualObjectiveLimitReached();
 }
 
 bool Problem::isIterationLimitReached() const
 {
+    if (cached() != NULL)
+    {
+        return (cached()->statuses & CACHED_ITERATION_LIMIT) != 0;
+    }
     return _solver->isIterationLimitReached();
 }
 
+std::string Problem::getSolverName() const
+{
+    return _solverName;
+}
+
+OsiSolverInterface * Problem::getSolverInterface() const
+{
+    return _solver.get();
+}
+
+double Problem::getInfinity() const
+{
+    return _solver->getInfinity();
+}
+
+void Problem::clear(bool keepParams)
+{
+    unmarkHotStart();
+    clearMipStart();
+    _sharedModel.reset();
+    _cachedSolution.reset();
+    if (keepParams)
+    {
+        std::vector<int> indices;
+        for (int i = 0; i < getNumRows(); ++i)
+        {
+            indices.push_back(i);
+        }
+        if (!indices.empty())
+        {
+            _solver->deleteRows(indices.size(), &indices[0]);
+        }
+        indices.clear();
+        for (int i = 0; i < getNumCols(); ++i)
+        {
+            indices.push_back(i);
+        }
+        if (!indices.empty())
+        {
+            _solver->deleteCols(indices.size(), &indices[0]);
+        }
+    }
+    else
+    {
+        try
+        {
+            _solver->reset();
+        }
+        catch (...)
+        {
+            // this interface can not be reset, take a fresh one
+            _solver = SolverPool::acquire(_solverName);
+        }
+        _solver->setIntParam(OsiNameDiscipline, 2);
+    }
+    // as a new problem
+    setMaximize(false);
+    _solver->setDblParam(OsiObjOffset, 0);
+    _solver->setObjName("");
+    _solver->setStrParam(OsiProbName, _defaultProbName);
+    _hasBeenSolved = false;
+    _mipEvents.clear();
+    _stats = SolveStats();
+    _lastSolveEnd = CoinWallclockTime();
+    _rows.update();
+    _cols.update();
+}
+
 //-------------------------------------------------------------//
 // PROBNAME
 //-------------------------------------------------------------//
@@ -405,6 +609,8 @@ bool Problem::getMaximize() const
 
 void Problem::setMaximize(bool maximize)
 {
+    // not restored by the scenarios
+    _sharedModel.reset();
     if (maximize)
     {
         _solver->setObjSense(-1);
@@ -430,6 +636,7 @@ void Problem::setInteger(int index, bool isInteger)
     {
         throw std::runtime_error("Index out of range");
     }
+    _sharedModel.reset();
     if (isInteger)
     {
         _solver->setInteger(index);
@@ -479,6 +686,19 @@ void Problem::addRow(const CoinPackedVector &vector)
         }
     }
     _solver->addRow(vector, - _solver->getInfinity(), _solver->getInfinity());
+    _sharedModel.reset();
+}
+
+void Problem::addRows(const SparseBatch &rows)
+{
+    checkBatch(rows, getNumCols(), "Index out of range, add more columns");
+    if (rows.size() == 0)
+    {
+        return;
+    }
+    _solver->addRows(rows.size(), first(rows.starts), first(rows.indices),
+            first(rows.values), first(rows.lower), first(rows.upper));
+    _sharedModel.reset();
 }
 
 std::string Problem::getRowName(int index) const
@@ -549,6 +769,7 @@ void Problem::deleteRow(int index)
     int indices[1];
     indices[0] = index;
     _solver->deleteRows(1, indices);
+    _sharedModel.reset();
 }
 
 //-------------------------------------------------------------//
@@ -631,6 +852,22 @@ void Problem::addCol(const CoinPackedVector &vector)
         }
     }
     _solver->addCol(vector, -_solver->getInfinity(), _solver->getInfinity(), 0);
+    _sharedModel.reset();
+}
+
+void Problem::addCols(const SparseBatch &cols)
+{
+    checkBatch(cols, getNumRows(), "Index out of range, add more _rows");
+    if (cols.size() == 0)
+    {
+        return;
+    }
+    std::vector<double> objective(cols.objective);
+    objective.resize(cols.size(), 0);
+    _solver->addCols(cols.size(), first(cols.starts), first(cols.indices),
+            first(cols.values), first(cols.lower), first(cols.upper),
+            first(objective));
+    _sharedModel.reset();
 }
 
 void Problem::deleteCol(int index)
@@ -642,6 +879,8 @@ void Problem::deleteCol(int index)
     int indices[1];
     indices[0] = index;
     _solver->deleteCols(1, indices);
+    _sharedModel.reset();
+    deleteMipStartCols(std::vector<int>(1, index));
 }
 
 //-------------------------------------------------------------//
@@ -665,148 +904,976 @@ void Problem::unmarkHotStart()
 
 void Problem::solve(bool considerMIP)
 {
+    // before the timers: the compaction is not part of the solve
+    if (!_hasHotStart && _autoCompactRatio >= 0
+            && getMatrixGapRatio() > _autoCompactRatio)
+    {
+        compact();
+    }
+    SolveStats stats;
+    double wall = CoinWallclockTime();
+    double cpu = threadCpuTime();
+    long peakRss = peakResidentSetSize();
+    stats.modelTime = wall - _lastSolveEnd;
+    _cachedSolution.reset();
+    std::string key;
+    if (_solutionCache)
+    {
+        key = cacheKey(considerMIP);
+        CachedSolutionPtr hit = _solutionCache->find(key);
+        // only the optimal results are stored, but older files may hold
+        // others
+        if (hit && (hit->statuses & CACHED_OPTIMAL) != 0
+                && hit->colSolution.size() == static_cast< std::size_t >(
+                    getNumCols())
+                && hit->rowPrice.size() == static_cast< std::size_t >(
+                    getNumRows()))
+        {
+            _cachedSolution = hit;
+            // for the drivers reading the solver directly
+            if (!hit->colSolution.empty())
+            {
+                _solver->setColSolution(&hit->colSolution[0]);
+            }
+            if (!hit->rowPrice.empty())
+            {
+                _solver->setRowPrice(&hit->rowPrice[0]);
+            }
+            stats.lpPhase = "cache";
+            stats.lpWallTime = CoinWallclockTime() - wall;
+            stats.lpCpuTime = threadCpuTime() - cpu;
+            _stats = stats;
+            // _hasBeenSolved is left as is: the solver still has to
+            // solve the model from scratch the next time
+            if (considerMIP)
+            {
+                // the stored results are optimal: no gap
+                MipEvent finished;
+                finished.kind = "finished";
+                finished.objective = hit->objValue;
+                finished.bound = hit->objValue;
+                reportMipEvent(finished);
+            }
+            _lastSolveEnd = CoinWallclockTime();
+            return;
+        }
+    }
     if (_hasHotStart)
     {
+        stats.lpPhase = "hotStart";
         _solver->solveFromHotStart();
     }
     else if (_hasBeenSolved)
     {
+        stats.lpPhase = "resolve";
         _solver->resolve();
     }
     else
     {
+        stats.lpPhase = "initialSolve";
         _solver->initialSolve();
     }
+    stats.lpWallTime = CoinWallclockTime() - wall;
+    stats.lpCpuTime = threadCpuTime() - cpu;
+    stats.lpIterations = _solver->getIterationCount();
     if (considerMIP)
     {
+        wall = CoinWallclockTime();
+        cpu = threadCpuTime();
+        MipEvent finished;
+        finished.kind = "finished";
+#ifdef Cbc
+        OsiCbcSolverInterface * cbc =
+            dynamic_cast< OsiCbcSolverInterface * >(_solver.get());
+        if (cbc != NULL)
+        {
+            // the model keeps its own copy of the handler
+            ProblemEventHandler handler(this, _mipEventInterval);
+            cbc->getModelPtr()->passInEventHandler(&handler);
+        }
+#endif
+        applyMipStart();
         _solver->branchAndBound();
-    }
+        stats.mipWallTime = CoinWallclockTime() - wall;
+        stats.mipCpuTime = threadCpuTime() - cpu;
+        stats.mipIterations = _solver->getIterationCount();
+        finished.objective = _solver->getObjValue();
+        finished.bound = finished.objective;
+        // as in the events of the search, no incumbent, no gap
+        bool hasIncumbent = _solver->isProvenOptimal();
+#ifdef Cbc
+        if (cbc != NULL)
+        {
+            finished.nodes = cbc->getModelPtr()->getNodeCount();
+            finished.bound = cbc->getModelPtr()->getBestPossibleObjValue();
+            stats.mipIterations = cbc->getModelPtr()->getIterationCount();
+            hasIncumbent = (cbc->getModelPtr()->getSolutionCount() > 0);
+        }
+#endif
+        stats.nodes = finished.nodes;
+        finished.gap = hasIncumbent
+            ? relativeGap(finished.objective, finished.bound)
+            : std::numeric_limits<double>::infinity();
+        reportMipEvent(finished);
+    }
+    stats.peakRssDelta = peakResidentSetSize() - peakRss;
+    _stats = stats;
     _hasBeenSolved = true;
+    // not the infeasible or unbounded results: their rays (as Benders
+    // asks) can only come from a solver that solved the model
+    if (_solutionCache && isProvenOptimal())
+    {
+        boost::shared_ptr< CachedSolution > result(new CachedSolution());
+        const bool statuses[] = {isAbandoned(), isProvenOptimal(),
+            isProvenPrimalInfeasible(), isProvenDualInfeasible(),
+            isPrimalObjectiveLimitReached(), isDualObjectiveLimitReached(),
+            isIterationLimitReached()};
+        for (int k = 0; k < 7; ++k)
+        {
+            result->statuses |= statuses[k] ? (1u << k) : 0;
+        }
+        result->objValue = _solver->getObjValue();
+        int numCols = getNumCols();
+        int numRows = getNumRows();
+        const double * vectors[] = {_solver->getColSolution(),
+            _solver->getReducedCost(), _solver->getRowPrice(),
+            _solver->getRowActivity()};
+        Values * copies[] = {&result->colSolution, &result->reducedCost,
+            &result->rowPrice, &result->rowActivity};
+        for (int v = 0; v < 4; ++v)
+        {
+            int size = (v < 2) ? numCols : numRows;
+            if (vectors[v] != NULL)
+            {
+                copies[v]->assign(vectors[v], vectors[v] + size);
+            }
+            else
+            {
+                copies[v]->assign(size, 0);
+            }
+        }
+        _solutionCache->insert(key, result);
+    }
+    _lastSolveEnd = CoinWallclockTime();
 }
 
-std::string Problem::getSolverStatus() const
+const SolveStats &Problem::getStats() const
 {
-    std::string res = "undefined";
-    if (isAbandoned())
-    {
-        res = "abandoned";
-    }
-    if (isProvenOptimal())
-    {
-        res = "optimal";
-    }
-    if (isProvenPrimalInfeasible() || isProvenDualInfeasible())
-    {
-        res = "infeasible";
-    }
-    if (isPrimalObjectiveLimitReached()
-            || isDualObjectiveLimitReached()
-            || isIterationLimitReached())
-    {
-        res = "limitreached";
-    }
-    return res;
+    return _stats;
 }
 
-double Problem::getObjValue() const
+boost::shared_ptr< SolutionCache > Problem::getSolutionCache() const
 {
-    return _solver->getObjValue();
+    return _solutionCache;
 }
 
-double Problem::getColSolution(int index) const
+void Problem::setSolutionCache(boost::shared_ptr< SolutionCache > cache)
 {
-    if (index >= getNumCols() or index < 0)
-    {
-        throw std::runtime_error("Index out of range");
-    }
-    return _solver->getColSolution()[index];
+    _solutionCache = cache;
 }
 
-void Problem::setColSolution(int index, double value)
+const CachedSolution * Problem::cached() const
 {
-    if (index >= getNumCols() or index < 0)
+    if (!_cachedSolution
+            || _cachedSolution->colSolution.size()
+                != static_cast< std::size_t >(getNumCols())
+            || _cachedSolution->rowPrice.size()
+                != static_cast< std::size_t >(getNumRows()))
     {
-        throw std::runtime_error("Index out of range");
+        return NULL;
     }
-    const double *sol = _solver->getColSolution();
-    double * array = new double[getNumCols()];
-    for (int i = 0; i < getNumCols(); ++i)
+    return _cachedSolution.get();
+}
+
+std::string Problem::cacheKey(bool considerMIP) const
+{
+    std::string fingerprint = this->fingerprint(std::vector< std::string >(
+                FINGERPRINT_PARTS, FINGERPRINT_PARTS + NUM_FINGERPRINT_PARTS));
+    Values params;
+    getSolverParams(params);
+    params.push_back(_mipGapLimit);
+    Fingerprint key;
+    key.update(fingerprint.data(), fingerprint.size());
+    key.update(_solverName.data(), _solverName.size());
+    key.updateInt(considerMIP ? 1 : 0);
+    key.updateDoubles(params.empty() ? NULL : &params[0], params.size(),
+            getInfinity());
+    return key.hexDigest();
+}
+
+// Bytes of a packed matrix: its entries (up to the last used one, gaps
+// included), starts and lengths
+static std::size_t matrixBytes(const CoinPackedMatrix * matrix,
+        std::size_t &gaps)
+{
+    gaps = 0;
+    if (matrix == NULL)
     {
-        array[i] = sol[i];
+        return 0;
     }
-    array[index] = value;
-    _solver->setColSolution(array);
-    delete[] array;
+    int majorDim = matrix->getMajorDim();
+    std::size_t stored = (majorDim > 0) ? matrix->getVectorStarts()[majorDim]
+        : 0;
+    std::size_t used = matrix->getNumElements();
+    std::size_t entry = sizeof(int) + sizeof(double);
+    gaps = (stored > used) ? (stored - used) * entry : 0;
+    return stored * entry + (majorDim + 1) * sizeof(CoinBigIndex)
+        + majorDim * sizeof(int);
 }
 
-double Problem::getReducedCost(int index) const
+static std::size_t namesBytes(const OsiSolverInterface::OsiNameVec &names)
 {
-    if (index >= getNumCols() or index < 0)
+    std::size_t res = names.capacity() * sizeof(std::string);
+    for (std::size_t k = 0; k < names.size(); ++k)
     {
-        throw std::runtime_error("Index out of range");
+        res += names[k].size() + 1;
     }
-    return _solver->getReducedCost()[index];
+    return res;
 }
 
-double Problem::getDualValue(int index) const
+MemoryUsage Problem::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    std::size_t numCols = getNumCols();
+    std::size_t numRows = getNumRows();
+    usage.matrixByCol = matrixBytes(_solver->getMatrixByCol(),
+            usage.matrixGaps);
+    std::size_t rowGaps;
+    usage.matrixByRow = matrixBytes(_solver->getMatrixByRow(), rowGaps);
+    // lower, upper, objective, integrality / lower, upper, sense, rhs,
+    // range
+    usage.bounds = numCols * (3 * sizeof(double) + sizeof(char))
+        + numRows * (4 * sizeof(double) + sizeof(char));
+    // primal, reduced costs / duals, activities
+    usage.solution = (numCols + numRows) * 2 * sizeof(double);
+    usage.names = namesBytes(_solver->getColNames())
+        + namesBytes(_solver->getRowNames());
+    if (_hasBeenSolved)
+    {
+        CoinWarmStart * warmStart = _solver->getWarmStart();
+        const CoinWarmStartBasis * basis =
+            dynamic_cast< const CoinWarmStartBasis * >(warmStart);
+        if (basis != NULL)
+        {
+            // 2 bits per status, stored in words of 16 statuses
+            usage.warmStart = ((basis->getNumStructural() + 15) / 16
+                    + (basis->getNumArtificial() + 15) / 16) * 4;
+        }
+        delete warmStart;
+    }
+    usage.handles = _rows.memoryUsage() + _cols.memoryUsage();
+    usage.mipData = _mipStartIndices.capacity() * sizeof(int)
+        + _mipStartValues.capacity() * sizeof(double)
+        + _mipEvents.size() * sizeof(MipEvent);
+    return usage;
+}
+
+// Widens [min, max] to the nonzero finite absolute values
+static void addToRange(const double * values, int size, double infinity,
+        double &min, double &max)
 {
-    if (index >= getNumRows() or index < 0)
+    for (int k = 0; k < size; ++k)
     {
-        throw std::runtime_error("Index out of range");
+        double value = std::fabs(values[k]);
+        if (value > 0 && value < infinity)
+        {
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
     }
-    return _solver->getRowPrice()[index];
 }
 
-void Problem::setDualValue(int index, double value)
+// Bucket of a count of nonzeros (see ModelStats)
+static void addToHistogram(Indices &histogram, int count)
 {
-    if (index >= getNumRows() or index < 0)
+    std::size_t bucket = 0;
+    for (; count > 0; count >>= 1)
     {
-        throw std::runtime_error("Index out of range");
+        ++bucket;
     }
-    const double *duals = _solver->getRowPrice();
-    double * array = new double[getNumRows()];
-    for (int i = 0; i < getNumRows(); ++i)
+    if (histogram.size() <= bucket)
     {
-        array[i] = duals[i];
+        histogram.resize(bucket + 1, 0);
     }
-    array[index] = value;
-    _solver->setRowPrice(array);
-    delete[] array;
+    ++histogram[bucket];
 }
 
-double Problem::getRowActivity(int index) const
+ModelStats Problem::analyze() const
 {
-    if (index >= getNumRows() or index < 0)
-    {
-        throw std::runtime_error("Index out of range");
+    ModelStats stats;
+    int numCols = getNumCols();
+    int numRows = getNumRows();
+    double infinity = getInfinity();
+    stats.numCols = numCols;
+    stats.numRows = numRows;
+
+    const CoinPackedMatrix * matrix = _solver->getMatrixByCol();
+    int majorDim = std::min(numCols, matrix->getMajorDim());
+    const CoinBigIndex * starts = matrix->getVectorStarts();
+    const int * lengths = matrix->getVectorLengths();
+    const int * indices = matrix->getIndices();
+    const double * elements = matrix->getElements();
+    Indices rowCounts(numRows, 0);
+    double min = DBL_MAX;
+    double max = 0;
+    for (int j = 0; j < numCols; ++j)
+    {
+        int length = (j < majorDim) ? lengths[j] : 0;
+        stats.numElements += length;
+        addToHistogram(stats.colHistogram, length);
+        stats.numEmptyCols += (length == 0);
+        stats.numSingletonCols += (length == 1);
+        if (length > 0)
+        {
+            addToRange(elements + starts[j], length, infinity, min, max);
+            for (CoinBigIndex k = starts[j]; k < starts[j] + length; ++k)
+            {
+                ++rowCounts[indices[k]];
+            }
+        }
     }
-    return _solver->getRowActivity()[index];
+    stats.minCoefficient = (max > 0) ? min : 0;
+    stats.maxCoefficient = max;
+    for (int i = 0; i < numRows; ++i)
+    {
+        addToHistogram(stats.rowHistogram, rowCounts[i]);
+        stats.numEmptyRows += (rowCounts[i] == 0);
+        stats.numSingletonRows += (rowCounts[i] == 1);
+    }
+
+    min = DBL_MAX;
+    max = 0;
+    addToRange(_solver->getObjCoefficients(), numCols, infinity, min, max);
+    stats.minObjective = (max > 0) ? min : 0;
+    stats.maxObjective = max;
+
+    const double * rowLower = _solver->getRowLower();
+    const double * rowUpper = _solver->getRowUpper();
+    min = DBL_MAX;
+    max = 0;
+    addToRange(rowLower, numRows, infinity, min, max);
+    addToRange(rowUpper, numRows, infinity, min, max);
+    stats.minRhs = (max > 0) ? min : 0;
+    stats.maxRhs = max;
+    for (int i = 0; i < numRows; ++i)
+    {
+        stats.numFreeRows += (rowLower[i] <= -infinity
+                && rowUpper[i] >= infinity);
+        stats.numEqualityRows += (rowLower[i] == rowUpper[i]);
+    }
+
+    const double * colLower = _solver->getColLower();
+    const double * colUpper = _solver->getColUpper();
+    min = DBL_MAX;
+    max = 0;
+    addToRange(colLower, numCols, infinity, min, max);
+    addToRange(colUpper, numCols, infinity, min, max);
+    stats.minBound = (max > 0) ? min : 0;
+    stats.maxBound = max;
+    for (int j = 0; j < numCols; ++j)
+    {
+        stats.numFreeCols += (colLower[j] <= -infinity
+                && colUpper[j] >= infinity);
+        stats.numFixedCols += (colLower[j] == colUpper[j]);
+        if (_solver->isInteger(j))
+        {
+            ++stats.numIntegerCols;
+            stats.numBinaryCols += (colLower[j] >= 0 && colUpper[j] <= 1);
+        }
+    }
+    return stats;
 }
 
-//-------------------------------------------------------------//
-// CONTENT
-//-------------------------------------------------------------//
-Indices Problem::getRowIndices(int row)
+SolutionCheck Problem::checkSolution(const Values &x, double tolerance) const
 {
-    Indices res;
-    if (row >= getNumRows() or row < 0)
+    int numCols = getNumCols();
+    int numRows = getNumRows();
+    if (x.size() != static_cast< std::size_t >(numCols))
     {
-        throw std::runtime_error("Index out of range");
+        throw std::runtime_error("The solution must have a value per column");
     }
+    SolutionCheck check;
+    // the rows are checked even without columns: their activity is 0
+    const double * values = x.empty() ? NULL : &x[0];
+
     const CoinPackedMatrix * matrix = _solver->getMatrixByRow();
-    CoinShallowPackedVector vector = matrix->getVector(row);
-    for(int i = 0; i < vector.getNumElements(); ++i)
-    {
-        res.push_back((vector.getIndices())[i]);
+    int majorDim = std::min(numRows, matrix->getMajorDim());
+    const CoinBigIndex * starts = matrix->getVectorStarts();
+    const int * lengths = matrix->getVectorLengths();
+    const int * indices = matrix->getIndices();
+    const double * elements = matrix->getElements();
+    const double * rowLower = _solver->getRowLower();
+    const double * rowUpper = _solver->getRowUpper();
+    double maxViolation = 0;
+    double sumViolations = 0;
+    int numViolations = 0;
+    #pragma omp parallel for schedule(static) \
+        reduction(max:maxViolation) reduction(+:sumViolations,numViolations) \
+        if (matrix->getNumElements() > PARALLEL_PRODUCT_MIN)
+    for (int i = 0; i < numRows; ++i)
+    {
+        double activity = 0;
+        if (i < majorDim)
+        {
+            for (CoinBigIndex k = starts[i]; k < starts[i] + lengths[i]; ++k)
+            {
+                activity += elements[k] * values[indices[k]];
+            }
+        }
+        double violation = std::max(0.0, std::max(rowLower[i] - activity,
+                    activity - rowUpper[i]));
+        maxViolation = std::max(maxViolation, violation);
+        sumViolations += violation;
+        numViolations += (violation > tolerance);
+    }
+    check.maxRowViolation = maxViolation;
+    check.sumRowViolations = sumViolations;
+    check.numRowViolations = numViolations;
+
+    const double * colLower = _solver->getColLower();
+    const double * colUpper = _solver->getColUpper();
+    const double * objective = _solver->getObjCoefficients();
+    double objValue = 0;
+    for (int j = 0; j < numCols; ++j)
+    {
+        double violation = std::max(0.0, std::max(colLower[j] - values[j],
+                    values[j] - colUpper[j]));
+        check.maxBoundViolation = std::max(check.maxBoundViolation, violation);
+        check.sumBoundViolations += violation;
+        check.numBoundViolations += (violation > tolerance);
+        if (_solver->isInteger(j))
+        {
+            violation = std::fabs(values[j] - std::floor(values[j] + 0.5));
+            check.maxIntegralityViolation =
+                std::max(check.maxIntegralityViolation, violation);
+            check.sumIntegralityViolations += violation;
+            check.numIntegralityViolations += (violation > tolerance);
+        }
+        objValue += objective[j] * values[j];
     }
-    return res;
+    // as OSI reports it
+    check.objValue = objValue - getObjOffset();
+    check.feasible = (check.numRowViolations == 0
+            && check.numBoundViolations == 0
+            && check.numIntegralityViolations == 0);
+    return check;
 }
 
-Values Problem::getRowElements(int row)
+void Problem::setMipStart(const Indices &indices, const Values &values)
 {
-    if (row >= getNumRows() or row < 0)
+    if (indices.size() != values.size())
     {
-        throw std::runtime_error("Index out of range");
+        throw std::runtime_error("Indices and values differ in size");
+    }
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        if (indices[i] >= getNumCols() or indices[i] < 0)
+        {
+            throw std::runtime_error("Index out of range");
+        }
+    }
+    _mipStartIndices = indices;
+    _mipStartValues = values;
+}
+
+void Problem::clearMipStart()
+{
+    _mipStartIndices.clear();
+    _mipStartValues.clear();
+}
+
+const Indices & Problem::getMipStartIndices() const
+{
+    return _mipStartIndices;
+}
+
+const Values & Problem::getMipStartValues() const
+{
+    return _mipStartValues;
+}
+
+void Problem::deleteMipStartCols(const std::vector<int> &deleted)
+{
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < _mipStartIndices.size(); ++i)
+    {
+        int index = _mipStartIndices[i];
+        std::vector<int>::const_iterator it =
+            std::lower_bound(deleted.begin(), deleted.end(), index);
+        if (it != deleted.end() && *it == index)
+        {
+            continue;
+        }
+        // shifted by the number of deleted columns before it
+        _mipStartIndices[kept] = index - (it - deleted.begin());
+        _mipStartValues[kept] = _mipStartValues[i];
+        ++kept;
+    }
+    _mipStartIndices.resize(kept);
+    _mipStartValues.resize(kept);
+}
+
+void Problem::applyMipStart()
+{
+    // a model read since may have less columns
+    Indices indices;
+    Values values;
+    for (std::size_t i = 0; i < _mipStartIndices.size(); ++i)
+    {
+        if (_mipStartIndices[i] < getNumCols())
+        {
+            indices.push_back(_mipStartIndices[i]);
+            values.push_back(_mipStartValues[i]);
+        }
+    }
+    if (indices.empty())
+    {
+        return;
+    }
+#ifdef Cpx
+    OsiCpxSolverInterface * cpx =
+        dynamic_cast< OsiCpxSolverInterface * >(_solver.get());
+    if (cpx != NULL)
+    {
+        int begin = 0;
+        int effort = CPX_MIPSTART_AUTO;
+        CPXaddmipstarts(cpx->getEnvironmentPtr(),
+                cpx->getLpPtr(OsiCpxSolverInterface::KEEPCACHED_ALL),
+                1, indices.size(), &begin, &indices[0], &values[0],
+                &effort, NULL);
+        return;
+    }
+#endif
+#ifdef Grb
+    OsiGrbSolverInterface * grb =
+        dynamic_cast< OsiGrbSolverInterface * >(_solver.get());
+    if (grb != NULL)
+    {
+        GRBsetdblattrlist(grb->getLpPtr(OsiGrbSolverInterface::KEEPCACHED_ALL),
+                GRB_DBL_ATTR_START, indices.size(), &indices[0], &values[0]);
+        return;
+    }
+#endif
+    // complete the assignment with the current solution, clamped to the
+    // bounds
+    int numCols = getNumCols();
+    const double * solution = _solver->getColSolution();
+    const double * lower = _solver->getColLower();
+    const double * upper = _solver->getColUpper();
+    std::vector<double> full(numCols, 0);
+    for (int j = 0; j < numCols; ++j)
+    {
+        double value = (solution != NULL) ? solution[j] : 0;
+        full[j] = std::min(std::max(value, lower[j]), upper[j]);
+    }
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        full[indices[i]] = values[i];
+    }
+#ifdef Cbc
+    OsiCbcSolverInterface * cbc =
+        dynamic_cast< OsiCbcSolverInterface * >(_solver.get());
+    if (cbc != NULL)
+    {
+        const double * objective = _solver->getObjCoefficients();
+        double value = 0;
+        for (int j = 0; j < numCols; ++j)
+        {
+            value += objective[j] * full[j];
+        }
+        // Cbc checks the solution and ignores it if it is infeasible
+        cbc->getModelPtr()->setBestSolution(&full[0], numCols,
+                value * _solver->getObjSense(), true);
+        return;
+    }
+#endif
+    _solver->setColSolution(&full[0]);
+}
+
+int Problem::solveWithRowGeneration(RowSeparator &separator, int maxRounds,
+        double tol, bool considerMIP)
+{
+    solve(considerMIP);
+    int rounds = 1;
+    while (rounds < maxRounds && isProvenOptimal())
+    {
+        SparseBatch candidates;
+        const double * x = _solver->getColSolution();
+        separator.separate(x, getNumCols(), candidates);
+        checkBatch(candidates, getNumCols(),
+                "Index out of range, add more columns");
+        SparseBatch violated;
+        for (int k = 0; k < candidates.size(); ++k)
+        {
+            double activity = 0;
+            for (int i = candidates.starts[k]; i < candidates.starts[k+1]; ++i)
+            {
+                activity += candidates.values[i] * x[candidates.indices[i]];
+            }
+            if (activity < candidates.lower[k] - tol
+                    || activity > candidates.upper[k] + tol)
+            {
+                violated.append(candidates, k);
+            }
+        }
+        if (violated.size() == 0)
+        {
+            break;
+        }
+        addRows(violated);
+        solve(considerMIP);
+        ++rounds;
+    }
+    return rounds;
+}
+
+int Problem::solveLexicographic(const std::vector< CoinPackedVector > &objectives,
+        const Values &tolerances, bool considerMIP)
+{
+    int numCols = getNumCols();
+    for (std::size_t k = 0; k < objectives.size(); ++k)
+    {
+        if (objectives[k].getNumElements() > 0 &&
+                objectives[k].getMaxIndex() >= numCols)
+        {
+            throw std::runtime_error("Index out of range, add more columns");
+        }
+    }
+    double sense = _solver->getObjSense();
+    int stages = 0;
+    for (std::size_t k = 0; k < objectives.size(); ++k)
+    {
+        // the whole objective at once: the basis of the previous stage
+        // stays primal feasible
+        std::vector<double> dense(numCols, 0);
+        const int * indices = objectives[k].getIndices();
+        const double * values = objectives[k].getElements();
+        for (int i = 0; i < objectives[k].getNumElements(); ++i)
+        {
+            dense[indices[i]] = values[i];
+        }
+        if (numCols > 0)
+        {
+            _solver->setObjective(&dense[0]);
+        }
+        solve(considerMIP);
+        if (!isProvenOptimal())
+        {
+            break;
+        }
+        ++stages;
+        if (k + 1 == objectives.size())
+        {
+            break;
+        }
+        // the solver did not solve it on a cache hit. The row bounds the
+        // product alone, without the offset OSI subtracts.
+        double value = getObjValue() + getObjOffset();
+        double tol = (k < tolerances.size()) ? tolerances[k] : 0;
+        double slack = tol * std::max(1.0, std::fabs(value));
+        double infinity = _solver->getInfinity();
+        if (sense > 0)
+        {
+            _solver->addRow(objectives[k], -infinity, value + slack);
+        }
+        else
+        {
+            _solver->addRow(objectives[k], value - slack, infinity);
+        }
+        _sharedModel.reset();
+        std::ostringstream name;
+        name << "lex_" << k;
+        _solver->setRowName(getNumRows() - 1, name.str());
+    }
+    return stages;
+}
+
+int Problem::solveWithColumnGeneration(ColumnPricer &pricer, int maxRounds,
+        double tol, int purgeAge)
+{
+    solve(false);
+    int rounds = 1;
+    // number of consecutive solves each column stayed non basic, and
+    // whether it was generated (only those are purged)
+    std::vector<int> ages(getNumCols(), 0);
+    std::vector<bool> generated(getNumCols(), false);
+    while (rounds < maxRounds && isProvenOptimal())
+    {
+        const double * duals = _solver->getRowPrice();
+        SparseBatch candidates;
+        pricer.price(duals, getNumRows(), candidates);
+        checkBatch(candidates, getNumRows(), "Index out of range, add more _rows");
+        double sense = _solver->getObjSense();
+        SparseBatch improving;
+        for (int k = 0; k < candidates.size(); ++k)
+        {
+            double reducedCost = candidates.objective.empty() ?
+                0 : candidates.objective[k];
+            for (int i = candidates.starts[k]; i < candidates.starts[k+1]; ++i)
+            {
+                reducedCost -= candidates.values[i] * duals[candidates.indices[i]];
+            }
+            if (sense * reducedCost < -tol)
+            {
+                improving.append(candidates, k);
+            }
+        }
+        if (improving.size() == 0)
+        {
+            break;
+        }
+        if (purgeAge > 0)
+        {
+            CoinWarmStart * warmStart = _solver->getWarmStart();
+            CoinWarmStartBasis * basis =
+                dynamic_cast< CoinWarmStartBasis * >(warmStart);
+            const double * x = _solver->getColSolution();
+            std::vector<int> purged;
+            for (int j = 0; j < getNumCols(); ++j)
+            {
+                bool isBasic = (basis != NULL) ?
+                    basis->getStructStatus(j) == CoinWarmStartBasis::basic :
+                    std::fabs(x[j]) > tol;
+                ages[j] = isBasic ? 0 : ages[j] + 1;
+                // a purged column must not contribute to the solution
+                if (generated[j] && ages[j] >= purgeAge && std::fabs(x[j]) <= tol)
+                {
+                    purged.push_back(j);
+                }
+            }
+            delete warmStart;
+            if (!purged.empty())
+            {
+                _solver->deleteCols(purged.size(), &purged[0]);
+                _sharedModel.reset();
+                deleteMipStartCols(purged);
+                for (int k = purged.size() - 1; k >= 0; --k)
+                {
+                    ages.erase(ages.begin() + purged[k]);
+                    generated.erase(generated.begin() + purged[k]);
+                }
+            }
+        }
+        addCols(improving);
+        ages.resize(getNumCols(), 0);
+        generated.resize(getNumCols(), true);
+        solve(false);
+        ++rounds;
+    }
+    return rounds;
+}
+
+std::string Problem::getSolverStatus() const
+{
+    std::string res = "undefined";
+    if (isAbandoned())
+    {
+        res = "abandoned";
+    }
+    if (isProvenOptimal())
+    {
+        res = "optimal";
+    }
+    if (isProvenPrimalInfeasible() || isProvenDualInfeasible())
+    {
+        res = "infeasible";
+    }
+    if (isPrimalObjectiveLimitReached()
+            || isDualObjectiveLimitReached()
+            || isIterationLimitReached())
+    {
+        res = "limitreached";
+    }
+    return res;
+}
+
+//-------------------------------------------------------------//
+// MIP EVENTS
+//-------------------------------------------------------------//
+bool Problem::reportMipEvent(const MipEvent &event)
+{
+    if (_mipEvents.size() >= MAX_PENDING_MIP_EVENTS)
+    {
+        _mipEvents.pop_front();
+    }
+    _mipEvents.push_back(event);
+    bool stop = (_mipGapLimit >= 0 && event.gap <= _mipGapLimit);
+    if (_mipListener && _mipListener->onEvent(event))
+    {
+        stop = true;
+    }
+    return stop;
+}
+
+std::vector< MipEvent > Problem::pollMipEvents()
+{
+    std::vector< MipEvent > res(_mipEvents.begin(), _mipEvents.end());
+    _mipEvents.clear();
+    return res;
+}
+
+void Problem::setMipEventListener(boost::shared_ptr< MipEventListener > listener)
+{
+    _mipListener = listener;
+}
+
+int Problem::getMipEventInterval() const
+{
+    return _mipEventInterval;
+}
+
+void Problem::setMipEventInterval(int interval)
+{
+    if (interval < 1)
+    {
+        throw std::runtime_error("The event interval must be positive");
+    }
+    _mipEventInterval = interval;
+}
+
+double Problem::getMipGapLimit() const
+{
+    return _mipGapLimit;
+}
+
+void Problem::setMipGapLimit(double gap)
+{
+    _mipGapLimit = gap;
+}
+
+double Problem::getObjValue() const
+{
+    if (cached() != NULL)
+    {
+        return cached()->objValue;
+    }
+    return _solver->getObjValue();
+}
+
+double Problem::getColSolution(int index) const
+{
+    if (index >= getNumCols() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    if (cached() != NULL)
+    {
+        return cached()->colSolution[index];
+    }
+    return _solver->getColSolution()[index];
+}
+
+void Problem::setColSolution(int index, double value)
+{
+    if (index >= getNumCols() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    const double *sol = _solver->getColSolution();
+    double * array = new double[getNumCols()];
+    for (int i = 0; i < getNumCols(); ++i)
+    {
+        array[i] = sol[i];
+    }
+    array[index] = value;
+    _solver->setColSolution(array);
+    delete[] array;
+    if (cached() != NULL)
+    {
+        boost::shared_ptr< CachedSolution > copy(
+                new CachedSolution(*cached()));
+        copy->colSolution[index] = value;
+        _cachedSolution = copy;
+    }
+}
+
+double Problem::getReducedCost(int index) const
+{
+    if (index >= getNumCols() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    if (cached() != NULL)
+    {
+        return cached()->reducedCost[index];
+    }
+    return _solver->getReducedCost()[index];
+}
+
+double Problem::getDualValue(int index) const
+{
+    if (index >= getNumRows() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    if (cached() != NULL)
+    {
+        return cached()->rowPrice[index];
+    }
+    return _solver->getRowPrice()[index];
+}
+
+void Problem::setDualValue(int index, double value)
+{
+    if (index >= getNumRows() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    const double *duals = _solver->getRowPrice();
+    double * array = new double[getNumRows()];
+    for (int i = 0; i < getNumRows(); ++i)
+    {
+        array[i] = duals[i];
+    }
+    array[index] = value;
+    _solver->setRowPrice(array);
+    delete[] array;
+    if (cached() != NULL)
+    {
+        boost::shared_ptr< CachedSolution > copy(
+                new CachedSolution(*cached()));
+        copy->rowPrice[index] = value;
+        _cachedSolution = copy;
+    }
+}
+
+double Problem::getRowActivity(int index) const
+{
+    if (index >= getNumRows() or index < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    if (cached() != NULL)
+    {
+        return cached()->rowActivity[index];
+    }
+    return _solver->getRowActivity()[index];
+}
+
+//-------------------------------------------------------------//
+// CONTENT
+//-------------------------------------------------------------//
+Indices Problem::getRowIndices(int row)
+{
+    Indices res;
+    if (row >= getNumRows() or row < 0)
+    {
+        throw std::runtime_error("Index out of range");
+    }
+    const CoinPackedMatrix * matrix = _solver->getMatrixByRow();
+    CoinShallowPackedVector vector = matrix->getVector(row);
+    for(int i = 0; i < vector.getNumElements(); ++i)
+    {
+        res.push_back((vector.getIndices())[i]);
+    }
+    return res;
+}
+
+Values Problem::getRowElements(int row)
+{
+    if (row >= getNumRows() or row < 0)
+    {
+        throw std::runtime_error("Index out of range");
     }
     const CoinPackedMatrix * matrix = _solver->getMatrixByRow();
     CoinShallowPackedVector vector = matrix->getVector(row);
@@ -850,22 +1917,669 @@ Values Problem::getColElements(int col)
     return res;
 }
 
+void Problem::parseModelFile(std::string filename, bool lp, int numThreads,
+        ModelData &model)
+{
+    MappedFile file(filename);
+    const char * data = file.data();
+    std::size_t size = file.size();
+    std::string decompressed;
+    std::string format = Compression::formatOf(filename);
+    if (!format.empty())
+    {
+        Compression::decompress(data, size, format, decompressed);
+        data = decompressed.data();
+        size = decompressed.size();
+    }
+    if (lp)
+    {
+        LpReader::read(data, size, model);
+    }
+    else
+    {
+        MpsReader::read(data, size, model, numThreads);
+    }
+}
+
 int Problem::readLp(std::string filename)
 {
+    // without the library, the backend reads the name as it did before
+    if (Compression::isAvailable(Compression::formatOf(filename)))
+    {
+        readLpNative(filename);
+        return 0;
+    }
+    _sharedModel.reset();
     return _solver->readLp(filename.data());
 }
 
 int Problem::readMps(std::string filename)
 {
+    // without the library, CoinMpsIO may still read the file (it
+    // understands gzip and bzip2 when it was built with them)
+    if (Compression::isAvailable(Compression::formatOf(filename)))
+    {
+        readMpsNative(filename, 0);
+        return 0;
+    }
+    _sharedModel.reset();
     return _solver->readMps(filename.data());
 }
 
+void Problem::readMpsNative(std::string filename, int numThreads)
+{
+    ModelData model;
+    parseModelFile(filename, false, numThreads, model);
+    loadModel(model);
+}
+
+void Problem::readLpNative(std::string filename)
+{
+    ModelData model;
+    parseModelFile(filename, true, 0, model);
+    loadModel(model);
+}
+
+void Problem::readLpBuffer(const char * data, std::size_t size)
+{
+    ModelData model;
+    LpReader::read(data, size, model);
+    loadModel(model);
+}
+
+void Problem::readMpsBuffer(const char * data, std::size_t size,
+        int numThreads)
+{
+    ModelData model;
+    MpsReader::read(data, size, model, numThreads);
+    loadModel(model);
+}
+
+void Problem::loadModel(const ModelData &model)
+{
+    unmarkHotStart();
+    _sharedModel.reset();
+    _cachedSolution.reset();
+    // infinite bounds, as the solver wants them
+    double infinity = _solver->getInfinity();
+    Values colLower(model.colLower);
+    Values colUpper(model.colUpper);
+    Values rowLower(model.rowLower);
+    Values rowUpper(model.rowUpper);
+    Values * bounds[] = {&colLower, &colUpper, &rowLower, &rowUpper};
+    for (int b = 0; b < 4; ++b)
+    {
+        Values &values = *bounds[b];
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = std::max(-infinity, std::min(infinity, values[i]));
+        }
+    }
+    _solver->loadProblem(model.numCols(), model.numRows(),
+            first(model.starts), first(model.indices), first(model.values),
+            first(colLower), first(colUpper), first(model.objective),
+            first(rowLower), first(rowUpper));
+    Indices integers;
+    for (int j = 0; j < model.numCols(); ++j)
+    {
+        if (model.integer[j])
+        {
+            integers.push_back(j);
+        }
+    }
+    if (!integers.empty())
+    {
+        _solver->setInteger(&integers[0], integers.size());
+    }
+    for (std::size_t j = 0; j < model.colNames.size(); ++j)
+    {
+        _solver->setColName(j, model.colNames[j]);
+    }
+    for (std::size_t i = 0; i < model.rowNames.size(); ++i)
+    {
+        _solver->setRowName(i, model.rowNames[i]);
+    }
+    _solver->setObjName(model.objName);
+    _solver->setStrParam(OsiProbName, model.name);
+    _solver->setDblParam(OsiObjOffset, model.objOffset);
+    setMaximize(model.maximize);
+    _hasBeenSolved = false;
+    _rows.update();
+    _cols.update();
+}
+
+void Problem::loadScenario(const Scenario &scenario)
+{
+    boost::shared_ptr< const ModelData > model =
+        scenario.getModel().getShared();
+    if (_sharedModel != model)
+    {
+        loadModel(*model);
+        _sharedModel = model;
+    }
+    scenario.apply(*_solver);
+}
+
+std::string Problem::fingerprint(const std::vector< std::string > &parts) const
+{
+    bool selected[NUM_FINGERPRINT_PARTS] = {false, false, false, false};
+    for (std::size_t k = 0; k < parts.size(); ++k)
+    {
+        const char ** part = std::find(FINGERPRINT_PARTS,
+                FINGERPRINT_PARTS + NUM_FINGERPRINT_PARTS, parts[k]);
+        if (part == FINGERPRINT_PARTS + NUM_FINGERPRINT_PARTS)
+        {
+            throw std::runtime_error(parts[k] + ": Unknown fingerprint part");
+        }
+        selected[part - FINGERPRINT_PARTS] = true;
+    }
+
+    // the solver may build its arrays when they are asked: not in the
+    // threads
+    int numCols = getNumCols();
+    int numRows = getNumRows();
+    const CoinPackedMatrix * matrix = _solver->getMatrixByCol();
+    int majorDim = std::min(numCols, matrix->getMajorDim());
+    const CoinBigIndex * starts = matrix->getVectorStarts();
+    const int * lengths = matrix->getVectorLengths();
+    double infinity = getInfinity();
+    const double * bounds[] = {_solver->getColLower(),
+        _solver->getColUpper(), _solver->getRowLower(),
+        _solver->getRowUpper()};
+    const double * objective = _solver->getObjCoefficients();
+    std::vector<char> integer(numCols);
+    for (int j = 0; j < numCols; ++j)
+    {
+        integer[j] = _solver->isInteger(j) ? 1 : 0;
+    }
+    double objOffset;
+    _solver->getDblParam(OsiObjOffset, objOffset);
+    bool maximize = getMaximize();
+
+    std::vector< std::string > digests(NUM_FINGERPRINT_PARTS);
+    #pragma omp parallel for schedule(dynamic)
+    for (int p = 0; p < NUM_FINGERPRINT_PARTS; ++p)
+    {
+        if (!selected[p])
+        {
+            continue;
+        }
+        Fingerprint hash;
+        if (p == 0)
+        {
+            hash.updateInt(numRows);
+            hash.updateInt(numCols);
+            for (int j = 0; j < numCols; ++j)
+            {
+                int length = (j < majorDim) ? lengths[j] : 0;
+                hash.updateInt(length);
+                if (length > 0)
+                {
+                    hash.updateInts(matrix->getIndices() + starts[j], length);
+                }
+            }
+            hash.update(integer.empty() ? NULL : &integer[0], integer.size());
+        }
+        else if (p == 1)
+        {
+            for (int j = 0; j < majorDim; ++j)
+            {
+                hash.updateDoubles(matrix->getElements() + starts[j],
+                        lengths[j], infinity);
+            }
+        }
+        else if (p == 2)
+        {
+            for (int b = 0; b < 4; ++b)
+            {
+                hash.updateDoubles(bounds[b], (b < 2) ? numCols : numRows,
+                        infinity);
+            }
+        }
+        else
+        {
+            hash.updateInt(maximize ? 1 : 0);
+            hash.updateDoubles(&objOffset, 1, infinity);
+            hash.updateDoubles(objective, numCols, infinity);
+        }
+        digests[p] = hash.hexDigest();
+    }
+
+    Fingerprint res;
+    for (int p = 0; p < NUM_FINGERPRINT_PARTS; ++p)
+    {
+        if (selected[p])
+        {
+            res.update(FINGERPRINT_PARTS[p], std::strlen(FINGERPRINT_PARTS[p]));
+            res.update(digests[p].data(), digests[p].size());
+        }
+    }
+    return res.hexDigest();
+}
+
+void Problem::getModel(ModelData &model) const
+{
+    int numCols = _solver->getNumCols();
+    int numRows = _solver->getNumRows();
+    // the vectors of the matrix may have gaps between them: the starts
+    // are computed first, then the columns are copied in parallel
+    const CoinPackedMatrix * matrix = _solver->getMatrixByCol();
+    int majorDim = std::min(numCols, matrix->getMajorDim());
+    const CoinBigIndex * starts = matrix->getVectorStarts();
+    const int * lengths = matrix->getVectorLengths();
+    model.starts.assign(numCols + 1, 0);
+    for (int j = 0; j < numCols; ++j)
+    {
+        model.starts[j+1] = model.starts[j] + ((j < majorDim) ? lengths[j] : 0);
+    }
+    model.indices.resize(model.starts[numCols]);
+    model.values.resize(model.starts[numCols]);
+    #pragma omp parallel for schedule(static) \
+        if (model.starts[numCols] > PARALLEL_COPY_MIN)
+    for (int j = 0; j < majorDim; ++j)
+    {
+        std::copy(matrix->getIndices() + starts[j],
+                matrix->getIndices() + starts[j] + lengths[j],
+                model.indices.begin() + model.starts[j]);
+        std::copy(matrix->getElements() + starts[j],
+                matrix->getElements() + starts[j] + lengths[j],
+                model.values.begin() + model.starts[j]);
+    }
+    // infinite bounds, as the model wants them
+    double infinity = _solver->getInfinity();
+    const double * bounds[] = {_solver->getColLower(), _solver->getColUpper(),
+        _solver->getRowLower(), _solver->getRowUpper()};
+    Values * copies[] = {&model.colLower, &model.colUpper, &model.rowLower,
+        &model.rowUpper};
+    for (int b = 0; b < 4; ++b)
+    {
+        int size = (b < 2) ? numCols : numRows;
+        copies[b]->resize(size);
+        for (int i = 0; i < size; ++i)
+        {
+            double value = bounds[b][i];
+            (*copies[b])[i] = (value >= infinity) ? DBL_MAX
+                : ((value <= -infinity) ? -DBL_MAX : value);
+        }
+    }
+    model.objective.assign(_solver->getObjCoefficients(),
+            _solver->getObjCoefficients() + numCols);
+    model.integer.resize(numCols);
+    model.colNames.resize(numCols);
+    for (int j = 0; j < numCols; ++j)
+    {
+        model.integer[j] = _solver->isInteger(j);
+        model.colNames[j] = _solver->getColName(j);
+    }
+    model.rowNames.resize(numRows);
+    for (int i = 0; i < numRows; ++i)
+    {
+        model.rowNames[i] = _solver->getRowName(i);
+    }
+    model.objName = _solver->getObjName();
+    model.maximize = getMaximize();
+    _solver->getDblParam(OsiObjOffset, model.objOffset);
+    _solver->getStrParam(OsiProbName, model.name);
+}
+
+// Parameters of the snapshots, in their order
+static const OsiIntParam SNAPSHOT_INT_PARAMS[] = {OsiMaxNumIteration,
+    OsiMaxNumIterationHotStart};
+static const OsiDblParam SNAPSHOT_DBL_PARAMS[] = {OsiDualObjectiveLimit,
+    OsiPrimalObjectiveLimit, OsiDualTolerance, OsiPrimalTolerance};
+static const OsiHintParam SNAPSHOT_HINT_PARAMS[] = {OsiDoPresolveInInitial,
+    OsiDoDualInInitial, OsiDoPresolveInResolve, OsiDoDualInResolve,
+    OsiDoScale, OsiDoCrash, OsiDoInBranchAndCut};
+static const int NUM_SNAPSHOT_INT_PARAMS = 2;
+static const int NUM_SNAPSHOT_DBL_PARAMS = 4;
+static const int NUM_SNAPSHOT_HINT_PARAMS = 7;
+
+void Problem::getSolverParams(Values &params) const
+{
+    params.clear();
+    for (int k = 0; k < NUM_SNAPSHOT_INT_PARAMS; ++k)
+    {
+        int value;
+        _solver->getIntParam(SNAPSHOT_INT_PARAMS[k], value);
+        params.push_back(value);
+    }
+    for (int k = 0; k < NUM_SNAPSHOT_DBL_PARAMS; ++k)
+    {
+        double value;
+        _solver->getDblParam(SNAPSHOT_DBL_PARAMS[k], value);
+        params.push_back(value);
+    }
+    for (int k = 0; k < NUM_SNAPSHOT_HINT_PARAMS; ++k)
+    {
+        bool value;
+        _solver->getHintParam(SNAPSHOT_HINT_PARAMS[k], value);
+        params.push_back(value ? 1 : 0);
+    }
+}
+
+void Problem::getSnapshot(SnapshotData &snapshot, bool withNames) const
+{
+    getModel(snapshot.model);
+    if (!withNames)
+    {
+        snapshot.model.name.clear();
+        snapshot.model.objName.clear();
+        snapshot.model.colNames.clear();
+        snapshot.model.rowNames.clear();
+    }
+    int numCols = snapshot.model.numCols();
+    int numRows = snapshot.model.numRows();
+
+    // the solver parameters, then yaposib's
+    Values &params = snapshot.params;
+    getSolverParams(params);
+    params.push_back(_mipGapLimit);
+    params.push_back(_mipEventInterval);
+    params.push_back(_autoCompactRatio);
+
+    snapshot.basis.clear();
+    CoinWarmStart * warmStart = _solver->getWarmStart();
+    CoinWarmStartBasis * basis =
+        dynamic_cast< CoinWarmStartBasis * >(warmStart);
+    if (basis != NULL && basis->getNumStructural() == numCols
+            && basis->getNumArtificial() == numRows)
+    {
+        for (int j = 0; j < numCols; ++j)
+        {
+            snapshot.basis.push_back(basis->getStructStatus(j));
+        }
+        for (int i = 0; i < numRows; ++i)
+        {
+            snapshot.basis.push_back(basis->getArtifStatus(i));
+        }
+    }
+    delete warmStart;
+
+    snapshot.solution.clear();
+    const double * colSolution = _solver->getColSolution();
+    const double * rowPrice = _solver->getRowPrice();
+    if (_hasBeenSolved && colSolution != NULL && rowPrice != NULL)
+    {
+        snapshot.solution.insert(snapshot.solution.end(), colSolution,
+                colSolution + numCols);
+        snapshot.solution.insert(snapshot.solution.end(), rowPrice,
+                rowPrice + numRows);
+    }
+}
+
+void Problem::setSnapshot(const SnapshotData &snapshot)
+{
+    loadModel(snapshot.model);
+    int numCols = snapshot.model.numCols();
+    int numRows = snapshot.model.numRows();
+
+    // a snapshot of an earlier version may have less parameters
+    const Values &params = snapshot.params;
+    std::size_t k = 0;
+    for (int p = 0; p < NUM_SNAPSHOT_INT_PARAMS && k < params.size(); ++p)
+    {
+        _solver->setIntParam(SNAPSHOT_INT_PARAMS[p],
+                static_cast< int >(params[k++]));
+    }
+    for (int p = 0; p < NUM_SNAPSHOT_DBL_PARAMS && k < params.size(); ++p)
+    {
+        _solver->setDblParam(SNAPSHOT_DBL_PARAMS[p], params[k++]);
+    }
+    for (int p = 0; p < NUM_SNAPSHOT_HINT_PARAMS && k < params.size(); ++p)
+    {
+        _solver->setHintParam(SNAPSHOT_HINT_PARAMS[p], params[k++] != 0);
+    }
+    if (k < params.size())
+    {
+        _mipGapLimit = params[k++];
+    }
+    if (k < params.size())
+    {
+        _mipEventInterval = std::max(1, static_cast< int >(params[k++]));
+    }
+    if (k < params.size())
+    {
+        _autoCompactRatio = params[k++];
+    }
+
+    if (!snapshot.basis.empty())
+    {
+        CoinWarmStartBasis basis;
+        basis.setSize(numCols, numRows);
+        for (int j = 0; j < numCols; ++j)
+        {
+            basis.setStructStatus(j, static_cast< CoinWarmStartBasis::Status >(
+                        snapshot.basis[j] & 3));
+        }
+        for (int i = 0; i < numRows; ++i)
+        {
+            basis.setArtifStatus(i, static_cast< CoinWarmStartBasis::Status >(
+                        snapshot.basis[numCols + i] & 3));
+        }
+        _solver->setWarmStart(&basis);
+    }
+    if (!snapshot.solution.empty())
+    {
+        _solver->setColSolution(&snapshot.solution[0]);
+        _solver->setRowPrice(&snapshot.solution[numCols]);
+    }
+}
+
+void Problem::save(std::string filename, bool withNames) const
+{
+    std::string data;
+    saveBuffer(data, withNames);
+    Compression::writeFile(filename, data);
+}
+
+void Problem::load(std::string filename)
+{
+    MappedFile file(filename);
+    std::string format = Compression::formatOf(filename);
+    if (format.empty())
+    {
+        loadBuffer(file.data(), file.size());
+        return;
+    }
+    std::string decompressed;
+    Compression::decompress(file.data(), file.size(), format, decompressed);
+    loadBuffer(decompressed.data(), decompressed.size());
+}
+
+void Problem::saveBuffer(std::string &out, bool withNames) const
+{
+    SnapshotData snapshot;
+    getSnapshot(snapshot, withNames);
+    Snapshot::write(snapshot, out);
+}
+
+void Problem::loadBuffer(const char * data, std::size_t size)
+{
+    SnapshotData snapshot;
+    Snapshot::read(data, size, snapshot);
+    setSnapshot(snapshot);
+}
+
+void Problem::compact()
+{
+    // only the interfaces storing a column-major matrix (Clp) give it;
+    // the others hand out a tight copy built on demand
+    CoinPackedMatrix * matrix = _solver->getMutableMatrixByCol();
+    if (matrix == NULL)
+    {
+        return;
+    }
+    // the same entries, without gaps nor spare capacity, swapped in place:
+    // the model is not reloaded, so the basis and the solution are kept
+    CoinPackedMatrix tight(*matrix, 0, 0);
+    matrix->swap(tight);
+}
+
+double Problem::getMatrixGapRatio() const
+{
+    const CoinPackedMatrix * matrix = _solver->getMutableMatrixByCol();
+    if (matrix == NULL)
+    {
+        matrix = _solver->getMatrixByCol();
+    }
+    int majorDim = matrix->getMajorDim();
+    double stored = (majorDim > 0) ? matrix->getVectorStarts()[majorDim] : 0;
+    return (stored > 0) ? 1 - matrix->getNumElements() / stored : 0;
+}
+
+double Problem::getAutoCompactRatio() const
+{
+    return _autoCompactRatio;
+}
+
+void Problem::setAutoCompactRatio(double ratio)
+{
+    _autoCompactRatio = ratio;
+}
+
 void Problem::writeLp(std::string filename) const
 {
+    if (Compression::isAvailable(Compression::formatOf(filename)))
+    {
+        std::string text;
+        writeLpBuffer(text);
+        Compression::writeFile(filename, text);
+        return;
+    }
     _solver->writeLp(filename.data());
 }
 
 void Problem::writeMps(std::string filename) const
 {
+    if (Compression::isAvailable(Compression::formatOf(filename)))
+    {
+        std::string text;
+        writeMpsBuffer(text);
+        Compression::writeFile(filename, text);
+        return;
+    }
     _solver->writeMps(filename.data());
 }
+
+void Problem::writeMpsBuffer(std::string &out) const
+{
+    ModelData model;
+    getModel(model);
+    ModelWriter::writeMps(model, out);
+}
+
+void Problem::writeLpBuffer(std::string &out) const
+{
+    ModelData model;
+    getModel(model);
+    ModelWriter::writeLp(model, out);
+}
+
+std::vector< std::string > Problem::exportSolution(std::string path,
+        std::string format, const std::vector< std::string > &what,
+        bool names) const
+{
+    if (format != "npy" && format != "csv")
+    {
+        throw std::runtime_error(format + ": Unknown solution format");
+    }
+    std::vector< SolutionFile::Column > colColumns;
+    std::vector< SolutionFile::Column > rowColumns;
+    for (std::size_t k = 0; k < what.size(); ++k)
+    {
+        SolutionFile::Column column;
+        column.name = what[k];
+        bool onCols = (what[k] == "primal" || what[k] == "reduced");
+        const CachedSolution * result = cached();
+        if (what[k] == "primal")
+        {
+            column.values = (result != NULL) ? first(result->colSolution)
+                : _solver->getColSolution();
+        }
+        else if (what[k] == "reduced")
+        {
+            column.values = (result != NULL) ? first(result->reducedCost)
+                : _solver->getReducedCost();
+        }
+        else if (what[k] == "dual")
+        {
+            column.values = (result != NULL) ? first(result->rowPrice)
+                : _solver->getRowPrice();
+        }
+        else if (what[k] == "activity")
+        {
+            column.values = (result != NULL) ? first(result->rowActivity)
+                : _solver->getRowActivity();
+        }
+        else
+        {
+            throw std::runtime_error(what[k] + ": Unknown solution vector");
+        }
+        int size = onCols ? getNumCols() : getNumRows();
+        if (column.values == NULL && size > 0)
+        {
+            throw std::runtime_error("No " + what[k] + " solution to export");
+        }
+        (onCols ? colColumns : rowColumns).push_back(column);
+    }
+
+    std::vector< std::string > colNames;
+    std::vector< std::string > rowNames;
+    if (names && !colColumns.empty())
+    {
+        colNames.resize(getNumCols());
+        for (int j = 0; j < getNumCols(); ++j)
+        {
+            colNames[j] = _solver->getColName(j);
+        }
+    }
+    if (names && !rowColumns.empty())
+    {
+        rowNames.resize(getNumRows());
+        for (int i = 0; i < getNumRows(); ++i)
+        {
+            rowNames[i] = _solver->getRowName(i);
+        }
+    }
+
+    std::vector< std::string > files;
+    if (format == "csv")
+    {
+        if (!colColumns.empty())
+        {
+            files.push_back(path + ".cols.csv");
+            SolutionFile::writeCsv(files.back(), colNames, colColumns,
+                    getNumCols());
+        }
+        if (!rowColumns.empty())
+        {
+            files.push_back(path + ".rows.csv");
+            SolutionFile::writeCsv(files.back(), rowNames, rowColumns,
+                    getNumRows());
+        }
+        return files;
+    }
+    if (!colNames.empty())
+    {
+        files.push_back(path + ".colnames.npy");
+        SolutionFile::writeNpy(files.back(), colNames);
+    }
+    if (!rowNames.empty())
+    {
+        files.push_back(path + ".rownames.npy");
+        SolutionFile::writeNpy(files.back(), rowNames);
+    }
+    for (std::size_t k = 0; k < colColumns.size(); ++k)
+    {
+        files.push_back(path + "." + colColumns[k].name + ".npy");
+        SolutionFile::writeNpy(files.back(), colColumns[k].values,
+                getNumCols());
+    }
+    for (std::size_t k = 0; k < rowColumns.size(); ++k)
+    {
+        files.push_back(path + "." + rowColumns[k].name + ".npy");
+        SolutionFile::writeNpy(files.back(), rowColumns[k].values,
+                getNumRows());
+    }
+    return files;
+}
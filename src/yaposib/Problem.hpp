@@ -6,8 +6,19 @@
 /// @created:       2010-07-21
 
 #include <string>
+#include <deque>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 #include "CArrays.hpp"
+#include "Callbacks.hpp"
+#include "MemoryUsage.hpp"
+#include "ModelData.hpp"
+#include "ModelStats.hpp"
+#include "SolutionCheck.hpp"
+#include "SolveStats.hpp"
+#include "Snapshot.hpp"
+#include "SolutionCache.hpp"
+#include "SolverPool.hpp"
 #include "Row.hpp"
 #include "Col.hpp"
 #include "Obj.hpp"
@@ -15,16 +26,17 @@
 // forward declarations
 class OsiSolverInterface;
 class CoinPackedVector;
-
-// typedefs
-typedef boost::shared_ptr<OsiSolverInterface> SolverPtr;
+class Scenario;
 
 class Problem
 {
     private:
-        // OsiSolverInterface that is actually used
+        // OsiSolverInterface that is actually used (see SolverPool)
         SolverPtr _solver;
 
+        // Name of the solver ("Clp", "Cbc", ...)
+        std::string _solverName;
+
         // Do we have make a snapshot?
         bool _hasHotStart;
 
@@ -40,18 +52,99 @@ class Problem
         // Object modelling the objective of the problem
         Obj _obj;
 
+        // Events reported by the branch and bound, waiting to be polled
+        std::deque< MipEvent > _mipEvents;
+
+        // Optional synchronous receiver of the MIP events
+        boost::shared_ptr< MipEventListener > _mipListener;
+
+        // A "node" event is reported every _mipEventInterval nodes
+        int _mipEventInterval;
+
+        // Known integer solution given to the branch and bound
+        Indices _mipStartIndices;
+
+        Values _mipStartValues;
+
+        // The branch and bound stops as soon as the relative gap falls
+        // under this value (disabled if negative)
+        double _mipGapLimit;
+
+        // Before a solve, the problem is compacted when more than this
+        // fraction of the stored matrix entries are gaps (disabled if
+        // negative)
+        double _autoCompactRatio;
+
+        // Model the solver holds the matrix of, as long as the structure,
+        // integrality, sense and offset of the problem were not changed
+        // (see loadScenario). Kept alive while it is loaded.
+        boost::shared_ptr< const ModelData > _sharedModel;
+
+        // Statistics of the last solve
+        SolveStats _stats;
+
+        // Wall clock at the end of the last solve (or at the creation of
+        // the problem)
+        double _lastSolveEnd;
+
+        // Name the solver gives to a new problem, restored by clear()
+        std::string _defaultProbName;
+
+        // Optional cache of the results of the solves
+        boost::shared_ptr< SolutionCache > _solutionCache;
+
+        // Result of the last solve when it came from the cache (then the
+        // solver was not called)
+        CachedSolutionPtr _cachedSolution;
+
+        // Gives the MIP start to the solver, through its own mechanism
+        // if it has one
+        void applyMipStart();
+
+        // Renumbers the MIP start after the deletion of the given columns
+        // (sorted), whose values are dropped
+        void deleteMipStartCols(const std::vector<int> &deleted);
+
+        // The cached result of the last solve, if it still has the sizes
+        // of the problem (NULL otherwise)
+        const CachedSolution * cached() const;
+
+        // Key of the result of a solve in the cache: the fingerprint of
+        // the model, the solver, its parameters and considerMIP
+        std::string cacheKey(bool considerMIP) const;
+
+        // The parameters of the solver that are saved in snapshots
+        void getSolverParams(Values &params) const;
+
     public:
         // Constructor. Takes a string (solver to use) as an argument.
-        // Instanciates the internal solver
+        // Takes the internal solver from the SolverPool
         Problem(std::string solverName);
 
         // Copy constructor (safe to use). Also makes a deep copy of the
         // internal solver
         Problem(const Problem &tocopy);
 
-        // Destructor. Also calls the destructor of the internal solver
+        // Destructor. Also gives the internal solver back to the pool
         ~Problem();
 
+        // Returns the name of the solver in use
+        std::string getSolverName() const;
+
+        // Direct access to the internal solver, for the drivers written
+        // in C++ (see Benders.hpp). Not available from python.
+        OsiSolverInterface * getSolverInterface() const;
+
+        // Value the solver uses as infinity
+        double getInfinity() const;
+
+        // Empties the problem (rows, columns, objective and names) but
+        // keeps the internal solver, so that it can be filled again
+        // without building a new one. The problem becomes a minimization
+        // problem that was never solved. If keepParams is false, the
+        // solver is also reset to its default parameters.
+        void clear(bool keepParams);
+
         //-------------------------------------------------------------//
         // OBJECTIVE
         // The following methods are actually called through an object
@@ -98,6 +191,10 @@ class Problem
         // segfaulting on user error)
         void addRow(const CoinPackedVector &vector);
 
+        // Adds the given rows at once. It is checked that they are well
+        // formed and refer to existing columns.
+        void addRows(const SparseBatch &rows);
+
         // Returns the name of the row at the given index
         std::string getRowName(int index) const;
 
@@ -160,6 +257,11 @@ class Problem
         // existing rows.
         void addCol(const CoinPackedVector &vector);
 
+        // Adds the given columns at once (a null objective is used if
+        // cols.objective is empty). It is checked that they are well
+        // formed and refer to existing rows.
+        void addCols(const SparseBatch &cols);
+
         // Returns the column name
         std::string getColName(int index) const;
 
@@ -222,6 +324,49 @@ class Problem
         void solveNormal(){this->solve(false);}
         void solveMIP(){this->solve(true);}
 
+        // Sets a known (preferably feasible) assignment of the given
+        // columns, used by the next branch and bounds as a first
+        // incumbent. Cbc, Cplex and Gurobi use their MIP start
+        // mechanism, the other solvers only get it as column solution.
+        void setMipStart(const Indices &indices, const Values &values);
+
+        // Forgets the MIP start
+        void clearMipStart();
+
+        // The MIP start, renumbered when columns are deleted (the values
+        // of the deleted columns are dropped)
+        const Indices & getMipStartIndices() const;
+
+        const Values & getMipStartValues() const;
+
+        // Row generation. Solves, then gives the solution to the
+        // separator and adds the rows it returns that are violated by
+        // more than tol, then resolves (warm) and repeats until no row
+        // is violated or maxRounds solves were made. Returns the number
+        // of solves.
+        int solveWithRowGeneration(RowSeparator &separator, int maxRounds,
+                double tol, bool considerMIP);
+
+        // Lexicographic optimization. Optimizes each objective in turn
+        // (in the sense of the problem), from the basis of the previous
+        // stage. After a stage, a row named "lex_<k>" keeps the objective
+        // within tolerances[k] (relative, 0 if missing) of its optimal
+        // value. The last objective stays the objective of the problem,
+        // and the rows are kept. Stops at the first stage that is not
+        // optimal. Returns the number of stages solved.
+        int solveLexicographic(const std::vector< CoinPackedVector > &objectives,
+                const Values &tolerances, bool considerMIP);
+
+        // Column generation. Solves, then gives the dual values to the
+        // pricer and adds the columns it returns whose reduced cost
+        // improves the objective by more than tol, then resolves (warm)
+        // and repeats until no column improves or maxRounds solves were
+        // made. If purgeAge is positive, generated columns that stayed
+        // non basic for purgeAge solves are deleted. Returns the number
+        // of solves.
+        int solveWithColumnGeneration(ColumnPricer &pricer, int maxRounds,
+                double tol, int purgeAge);
+
         // returns a string describing the solver status
         // "undefined", "abandoned", "optimal", "infeasible" or
         // "limitreached".
@@ -235,19 +380,189 @@ class Problem
         // - isIterationLimitReached
         std::string getSolverStatus() const;
 
-        // read the problem from an lp file
+        // Statistics (times, iterations, nodes, memory) of the last solve
+        const SolveStats &getStats() const;
+
+        // If a cache is set, solve first looks for the result of the same
+        // model (see fingerprint), solved by the same solver with the same
+        // parameters. On a hit, the stored statuses, objective value and
+        // solution vectors are returned without calling the solver (the
+        // stats say "cache" as lpPhase). Optimal results only are stored.
+        // An empty pointer disables it.
+        boost::shared_ptr< SolutionCache > getSolutionCache() const;
+
+        void setSolutionCache(boost::shared_ptr< SolutionCache > cache);
+
+        // Bytes held by the problem, part by part (see MemoryUsage.hpp).
+        // The row major copy of the matrix is built by the solver if it
+        // did not have it yet.
+        MemoryUsage getMemoryUsage() const;
+
+        // Sizes and numerics of the model (see ModelStats.hpp), in one
+        // pass over the matrix and one over the bounds
+        ModelStats analyze() const;
+
+        // Violations of the rows, bounds and integrality by the column
+        // solution x, and its objective, without solving nor changing the
+        // solution of the problem. The row activities are computed on the
+        // row major copy of the matrix (multi-threaded on large models).
+        SolutionCheck checkSolution(const Values &x, double tolerance) const;
+
+        // read the problem from an lp file. Files ending with ".gz",
+        // ".bz2" or ".zst" are decompressed in memory and read with
+        // yaposib's reader (then 0 is returned, errors throw), if yaposib
+        // was built with the library. Otherwise the solver reads them.
         int readLp(std::string filename);
 
-        // read the problem from an mps file
+        // read the problem from an mps file (compressed files as above)
         int readMps(std::string filename);
 
-        // write the problem in a lp file
+        // read the problem from an mps file with yaposib's reader: the
+        // file is mapped in memory (and decompressed if its name says
+        // so), its COLUMNS section is parsed by numThreads threads (0: as
+        // many as OpenMP wants) and the model is given to the solver at
+        // once. Throws on the first error.
+        void readMpsNative(std::string filename, int numThreads);
+
+        // read the problem from an lp file with yaposib's reader: the
+        // file is mapped in memory, parsed in a single pass and the model
+        // is given to the solver at once. Throws on the first error.
+        void readLpNative(std::string filename);
+
+        // same, from size bytes in memory
+        void readLpBuffer(const char * data, std::size_t size);
+
+        // Reads a model file (lp if lp is true, mps otherwise) into model,
+        // with yaposib's readers, without a solver. The file is
+        // decompressed in memory first if its name says so.
+        static void parseModelFile(std::string filename, bool lp,
+                int numThreads, ModelData &model);
+
+        // Replaces the whole problem with the model, in one loadProblem
+        void loadModel(const ModelData &model);
+
+        // Copies the whole problem into model
+        void getModel(ModelData &model) const;
+
+        // 128 bits hash of the parts of the problem, as 32 hexadecimal
+        // digits: "structure" (sizes, positions of the matrix entries,
+        // integrality), "coefficients" (matrix values), "bounds" (of the
+        // columns and rows) and "objective" (sense, offset, coefficients).
+        // Names are not hashed. Equal problems with their matrix entries
+        // stored in the same order have the same fingerprint. The parts
+        // are hashed in parallel.
+        std::string fingerprint(const std::vector< std::string > &parts) const;
+
+        // Gives the scenario to the solver. If the solver already holds
+        // the matrix of its model (the previous scenario loaded had the
+        // same model, and no row or column was added or deleted since),
+        // only the bounds and the objective are set, and the next solve
+        // is a resolve from the current basis. Otherwise the whole model
+        // is loaded first.
+        void loadScenario(const Scenario &scenario);
+
+        // Copies the whole state of the problem into snapshot: the model
+        // (names only if withNames), the parameters, the basis and the
+        // last solution
+        void getSnapshot(SnapshotData &snapshot, bool withNames) const;
+
+        // Replaces the whole state of the problem with the snapshot. The
+        // basis is given to the solver as warm start, and the solution
+        // as column solution and dual values.
+        void setSnapshot(const SnapshotData &snapshot);
+
+        // Writes the whole state of the problem in a binary file (see
+        // Snapshot.hpp), compressed if its name says so
+        void save(std::string filename, bool withNames) const;
+
+        // Replaces the whole state of the problem with the one saved in
+        // the file. Throws a runtime_error if it is not a snapshot.
+        void load(std::string filename);
+
+        // Replaces out with the snapshot of the problem (as save writes it)
+        void saveBuffer(std::string &out, bool withNames) const;
+
+        // Replaces the whole state of the problem with the snapshot in
+        // the size bytes of data
+        void loadBuffer(const char * data, std::size_t size);
+
+        // Replaces the solver's column-major matrix with a tightly packed
+        // copy, without the gaps and the extra capacity left by deletions
+        // and additions. The model is not reloaded: basis, solution and
+        // indices are kept. Does nothing for the solvers that do not
+        // store such a matrix.
+        void compact();
+
+        // Fraction of the stored matrix entries that are gaps
+        double getMatrixGapRatio() const;
+
+        // See _autoCompactRatio
+        double getAutoCompactRatio() const;
+
+        void setAutoCompactRatio(double ratio);
+
+        // write the problem in a lp file. If filename ends with ".gz",
+        // ".bz2" or ".zst" (and yaposib was built with the library), it
+        // is written as is, compressed, by yaposib's writer. Otherwise
+        // the solver adds the extension.
         void writeLp(std::string filename) const;
         void writeDefaultLp() const{this->writeLp("debug");}
 
-        // write the problem in a mps file
+        // write the problem in a mps file (compressed files as above)
         void writeMps(std::string filename) const;
-        void writeDefaultMps() const{this->writeLp("debug");}
+        void writeDefaultMps() const{this->writeMps("debug");}
+
+        // read the problem from size bytes of mps in memory, as
+        // readMpsNative reads a file
+        void readMpsBuffer(const char * data, std::size_t size,
+                int numThreads);
+
+        // Replaces out with the problem in free mps format (see
+        // ModelWriter.hpp)
+        void writeMpsBuffer(std::string &out) const;
+
+        // Replaces out with the problem in lp format
+        void writeLpBuffer(std::string &out) const;
+
+        // Writes the solution vectors listed in what ("primal",
+        // "reduced", "dual", "activity") in a single pass. With format
+        // "npy", every vector goes in <path>.<vector>.npy, and the names
+        // (if names) in <path>.colnames.npy and <path>.rownames.npy. With
+        // format "csv", the column vectors go in <path>.cols.csv and the
+        // row vectors in <path>.rows.csv, one line per column (or row).
+        // Returns the names of the files written.
+        std::vector< std::string > exportSolution(std::string path,
+                std::string format, const std::vector< std::string > &what,
+                bool names) const;
+
+        //-------------------------------------------------------------//
+        // MIP EVENTS
+        // Progress of the branch and bound. Only Cbc reports events
+        // while searching, the other solvers only report "finished".
+        //-------------------------------------------------------------//
+
+        // Records the given event (the oldest ones are dropped past
+        // 4096 pending events) and forwards it to the listener. Returns
+        // true if the branch and bound should stop.
+        bool reportMipEvent(const MipEvent &event);
+
+        // Returns the recorded events and forgets them
+        std::vector< MipEvent > pollMipEvents();
+
+        // Sets the object receiving the events synchronously (NULL to
+        // remove it)
+        void setMipEventListener(boost::shared_ptr< MipEventListener > listener);
+
+        // A "node" event is reported every given number of nodes
+        int getMipEventInterval() const;
+
+        void setMipEventInterval(int interval);
+
+        // Relative gap under which the branch and bound stops (negative
+        // to disable)
+        double getMipGapLimit() const;
+
+        void setMipGapLimit(double gap);
 
         //-------------------------------------------------------------//
         // TUNING
@@ -123,6 +123,11 @@ std::size_t Rows::size() const
     return _rows.size();
 }
 
+std::size_t Rows::memoryUsage() const
+{
+    return _rows.capacity() * sizeof(Row);
+}
+
 void Rows::update()
 {
     _rows.clear();
@@ -80,6 +80,9 @@ class Rows
 
         std::size_t size() const;
 
+        // Bytes held by the handles
+        std::size_t memoryUsage() const;
+
         void update();
 };
 
@@ -0,0 +1,381 @@
+#include "Snapshot.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <map>
+#include <cstring>
+
+// boost includes
+#include <boost/cstdint.hpp>
+
+using boost::uint32_t;
+using boost::uint64_t;
+
+static const char MAGIC[8] = {'Y', 'A', 'P', 'O', 'S', 'I', 'B', '\0'};
+
+// Readers refuse the snapshots of a later version
+static const uint32_t VERSION = 1;
+
+// Sections are aligned on that many bytes, so that a mapped snapshot can
+// be used in place
+static const std::size_t ALIGNMENT = 8;
+
+enum SectionId
+{
+    // numCols, numRows, numElements (int64)
+    SIZES = 1,
+    // maximize, objOffset (double)
+    SCALARS,
+    STARTS,
+    INDICES,
+    VALUES,
+    COL_LOWER,
+    COL_UPPER,
+    OBJECTIVE,
+    INTEGER,
+    ROW_LOWER,
+    ROW_UPPER,
+    // NUL terminated: problem and objective
+    NAMES,
+    PARAMS,
+    BASIS,
+    // column solution, then dual values
+    SOLUTION,
+    // NUL terminated, one per column (row)
+    COL_NAMES,
+    ROW_NAMES
+};
+
+struct Header
+{
+    char magic[8];
+
+    uint32_t version;
+
+    uint32_t numSections;
+};
+
+struct Section
+{
+    uint32_t id;
+
+    uint32_t elementSize;
+
+    uint64_t offset;
+
+    uint64_t count;
+};
+
+// A section before it is written
+struct PendingSection
+{
+    Section section;
+
+    const void * data;
+};
+
+template< typename T >
+static void addSection(std::vector< PendingSection > &sections, uint32_t id,
+        const std::vector<T> &values)
+{
+    PendingSection pending;
+    pending.section.id = id;
+    pending.section.elementSize = sizeof(T);
+    pending.section.offset = 0;
+    pending.section.count = values.size();
+    pending.data = values.empty() ? NULL : &values[0];
+    sections.push_back(pending);
+}
+
+// The strings, each followed by a NUL
+static void joinNames(const std::vector< const std::string * > &names,
+        std::vector<char> &out)
+{
+    out.clear();
+    for (std::size_t k = 0; k < names.size(); ++k)
+    {
+        out.insert(out.end(), names[k]->begin(), names[k]->end());
+        out.push_back('\0');
+    }
+}
+
+static void joinNames(const std::vector< std::string > &names,
+        std::vector<char> &out)
+{
+    std::vector< const std::string * > pointers;
+    for (std::size_t k = 0; k < names.size(); ++k)
+    {
+        pointers.push_back(&names[k]);
+    }
+    joinNames(pointers, out);
+}
+
+static std::size_t aligned(std::size_t offset)
+{
+    return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+void Snapshot::write(const SnapshotData &snapshot, std::string &out)
+{
+    const ModelData &model = snapshot.model;
+    std::vector< boost::int64_t > sizes;
+    sizes.push_back(model.numCols());
+    sizes.push_back(model.numRows());
+    sizes.push_back(model.values.size());
+    Values scalars;
+    scalars.push_back(model.maximize ? 1 : 0);
+    scalars.push_back(model.objOffset);
+    std::vector< const std::string * > modelNames;
+    modelNames.push_back(&model.name);
+    modelNames.push_back(&model.objName);
+    std::vector<char> names;
+    joinNames(modelNames, names);
+    std::vector<char> colNames;
+    joinNames(model.colNames, colNames);
+    std::vector<char> rowNames;
+    joinNames(model.rowNames, rowNames);
+
+    std::vector< PendingSection > sections;
+    addSection(sections, SIZES, sizes);
+    addSection(sections, SCALARS, scalars);
+    addSection(sections, STARTS, model.starts);
+    addSection(sections, INDICES, model.indices);
+    addSection(sections, VALUES, model.values);
+    addSection(sections, COL_LOWER, model.colLower);
+    addSection(sections, COL_UPPER, model.colUpper);
+    addSection(sections, OBJECTIVE, model.objective);
+    addSection(sections, INTEGER, model.integer);
+    addSection(sections, ROW_LOWER, model.rowLower);
+    addSection(sections, ROW_UPPER, model.rowUpper);
+    if (names.size() > 2)
+    {
+        addSection(sections, NAMES, names);
+    }
+    if (!model.colNames.empty())
+    {
+        addSection(sections, COL_NAMES, colNames);
+    }
+    if (!model.rowNames.empty())
+    {
+        addSection(sections, ROW_NAMES, rowNames);
+    }
+    addSection(sections, PARAMS, snapshot.params);
+    if (!snapshot.basis.empty())
+    {
+        addSection(sections, BASIS, snapshot.basis);
+    }
+    if (!snapshot.solution.empty())
+    {
+        addSection(sections, SOLUTION, snapshot.solution);
+    }
+
+    std::size_t offset = aligned(sizeof(Header)
+            + sections.size() * sizeof(Section));
+    for (std::size_t k = 0; k < sections.size(); ++k)
+    {
+        Section &section = sections[k].section;
+        section.offset = offset;
+        offset = aligned(offset + section.count * section.elementSize);
+    }
+    out.assign(offset, '\0');
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.numSections = sections.size();
+    std::memcpy(&out[0], &header, sizeof(header));
+    for (std::size_t k = 0; k < sections.size(); ++k)
+    {
+        const Section &section = sections[k].section;
+        std::memcpy(&out[sizeof(Header) + k * sizeof(Section)], &section,
+                sizeof(section));
+        if (section.count > 0)
+        {
+            std::memcpy(&out[section.offset], sections[k].data,
+                    section.count * section.elementSize);
+        }
+    }
+}
+
+// The sections of a snapshot in memory
+class SectionReader
+{
+    private:
+        const char * _data;
+
+        std::map< uint32_t, Section > _sections;
+
+    public:
+        SectionReader(const char * data, std::size_t size) :
+            _data(data)
+        {
+            Header header;
+            if (size < sizeof(header))
+            {
+                throw std::runtime_error("Not a yaposib snapshot");
+            }
+            std::memcpy(&header, data, sizeof(header));
+            if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+            {
+                throw std::runtime_error("Not a yaposib snapshot");
+            }
+            if (header.version > 0xffff)
+            {
+                throw std::runtime_error(
+                        "Snapshot written with another byte order");
+            }
+            if (header.version > VERSION)
+            {
+                throw std::runtime_error(
+                        "Snapshot written by a later version of yaposib");
+            }
+            if (header.numSections > (size - sizeof(header)) / sizeof(Section))
+            {
+                throw std::runtime_error("Truncated snapshot");
+            }
+            for (uint32_t k = 0; k < header.numSections; ++k)
+            {
+                Section section;
+                std::memcpy(&section,
+                        data + sizeof(header) + k * sizeof(Section),
+                        sizeof(section));
+                if (section.elementSize == 0 || section.offset > size
+                        || section.count
+                            > (size - section.offset) / section.elementSize)
+                {
+                    throw std::runtime_error("Truncated snapshot");
+                }
+                _sections[section.id] = section;
+            }
+        }
+
+        bool has(uint32_t id) const
+        {
+            return _sections.find(id) != _sections.end();
+        }
+
+        // Copies the section. If expected is not negative, it is the
+        // number of elements the section must have.
+        template< typename T >
+        void get(uint32_t id, std::vector<T> &values,
+                boost::int64_t expected) const
+        {
+            std::map< uint32_t, Section >::const_iterator it =
+                _sections.find(id);
+            if (it == _sections.end())
+            {
+                throw std::runtime_error("Snapshot without a required section");
+            }
+            const Section &section = it->second;
+            if (section.elementSize != sizeof(T)
+                    || (expected >= 0
+                        && section.count != static_cast< uint64_t >(expected)))
+            {
+                throw std::runtime_error("Inconsistent snapshot");
+            }
+            values.resize(section.count);
+            if (section.count > 0)
+            {
+                std::memcpy(&values[0], _data + section.offset,
+                        section.count * sizeof(T));
+            }
+        }
+
+        // Reads the NUL terminated strings of the section, if it exists.
+        // There must be expected of them.
+        void getNames(uint32_t id, std::vector< std::string > &names,
+                std::size_t expected) const
+        {
+            names.clear();
+            if (!has(id))
+            {
+                return;
+            }
+            std::vector<char> chars;
+            get(id, chars, -1);
+            std::size_t begin = 0;
+            for (std::size_t k = 0; k < chars.size(); ++k)
+            {
+                if (chars[k] == '\0')
+                {
+                    names.push_back(std::string(&chars[begin], &chars[k]));
+                    begin = k + 1;
+                }
+            }
+            if (begin != chars.size() || names.size() != expected)
+            {
+                throw std::runtime_error("Inconsistent snapshot");
+            }
+        }
+};
+
+void Snapshot::read(const char * data, std::size_t size,
+        SnapshotData &snapshot)
+{
+    SectionReader reader(data, size);
+    ModelData &model = snapshot.model;
+    std::vector< boost::int64_t > sizes;
+    reader.get(SIZES, sizes, 3);
+    boost::int64_t numCols = sizes[0];
+    boost::int64_t numRows = sizes[1];
+    boost::int64_t numElements = sizes[2];
+    if (numCols < 0 || numRows < 0 || numElements < 0
+            || numCols >= 0x7fffffff || numRows >= 0x7fffffff
+            || numElements >= 0x7fffffff)
+    {
+        throw std::runtime_error("Inconsistent snapshot");
+    }
+    Values scalars;
+    reader.get(SCALARS, scalars, 2);
+    model.maximize = (scalars[0] != 0);
+    model.objOffset = scalars[1];
+    reader.get(STARTS, model.starts, numCols + 1);
+    reader.get(INDICES, model.indices, numElements);
+    reader.get(VALUES, model.values, numElements);
+    reader.get(COL_LOWER, model.colLower, numCols);
+    reader.get(COL_UPPER, model.colUpper, numCols);
+    reader.get(OBJECTIVE, model.objective, numCols);
+    reader.get(INTEGER, model.integer, numCols);
+    reader.get(ROW_LOWER, model.rowLower, numRows);
+    reader.get(ROW_UPPER, model.rowUpper, numRows);
+    // the solver trusts the matrix
+    if (model.starts[0] != 0 || model.starts[numCols] != numElements)
+    {
+        throw std::runtime_error("Inconsistent snapshot");
+    }
+    for (boost::int64_t j = 0; j < numCols; ++j)
+    {
+        if (model.starts[j] > model.starts[j+1])
+        {
+            throw std::runtime_error("Inconsistent snapshot");
+        }
+    }
+    for (boost::int64_t k = 0; k < numElements; ++k)
+    {
+        if (model.indices[k] < 0 || model.indices[k] >= numRows)
+        {
+            throw std::runtime_error("Inconsistent snapshot");
+        }
+    }
+
+    std::vector< std::string > modelNames;
+    reader.getNames(NAMES, modelNames, 2);
+    model.name = modelNames.empty() ? "" : modelNames[0];
+    model.objName = modelNames.empty() ? "" : modelNames[1];
+    reader.getNames(COL_NAMES, model.colNames, numCols);
+    reader.getNames(ROW_NAMES, model.rowNames, numRows);
+
+    reader.get(PARAMS, snapshot.params, -1);
+    snapshot.basis.clear();
+    if (reader.has(BASIS))
+    {
+        reader.get(BASIS, snapshot.basis, numCols + numRows);
+    }
+    snapshot.solution.clear();
+    if (reader.has(SOLUTION))
+    {
+        reader.get(SOLUTION, snapshot.solution, numCols + numRows);
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+/// @file:          Snapshot.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "CArrays.hpp"
+#include "ModelData.hpp"
+
+// The whole state of a problem, as Problem::save writes it
+struct SnapshotData
+{
+    ModelData model;
+
+    // Solver parameters, in the order of Problem::getSnapshot
+    Values params;
+
+    // CoinWarmStartBasis statuses of the columns, then of the rows (empty
+    // if there is no basis)
+    std::vector<char> basis;
+
+    // Column solution and dual values of the last solve (empty if the
+    // problem was not solved)
+    Values solution;
+};
+
+// Binary format of the snapshots. A header (magic "YAPOSIB", version,
+// number of sections) is followed by a table of sections (id, size of an
+// element, offset, number of elements), then by the sections, each of
+// them an array of native integers, doubles or chars aligned on 8 bytes.
+// Reading is a bounds check and a copy per section: there is no parsing.
+// Sections a reader does not know are skipped, so that later versions
+// can add some.
+class Snapshot
+{
+    public:
+        // Replaces out with the snapshot. The names of the columns (of
+        // the rows) are only written if model.colNames (model.rowNames)
+        // is not empty.
+        static void write(const SnapshotData &snapshot, std::string &out);
+
+        // Reads size bytes of data. Throws a runtime_error if it is not a
+        // snapshot or if it is inconsistent.
+        static void read(const char * data, std::size_t size,
+                SnapshotData &snapshot);
+};
+
+#endif /* SNAPSHOT_HPP*/
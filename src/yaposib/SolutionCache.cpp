@@ -0,0 +1,287 @@
+#include "SolutionCache.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+#include "MappedFile.hpp"
+
+// std includes
+#include <stdexcept>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+// boost includes
+#include <boost/cstdint.hpp>
+
+// system includes
+#include <unistd.h>
+
+using boost::uint32_t;
+using boost::uint64_t;
+
+static const char MAGIC[8] = {'Y', 'A', 'P', 'O', 'S', 'O', 'L', '\0'};
+
+// Readers ignore the files of another version
+static const uint32_t VERSION = 1;
+
+// Followed by the column solution and reduced costs (numCols doubles
+// each), then the row prices and activities (numRows doubles each)
+struct CacheFileHeader
+{
+    char magic[8];
+
+    uint32_t version;
+
+    uint32_t statuses;
+
+    double objValue;
+
+    uint64_t numCols;
+
+    uint64_t numRows;
+};
+
+std::size_t CachedSolution::bytes() const
+{
+    return (colSolution.size() + reducedCost.size() + rowPrice.size()
+            + rowActivity.size()) * sizeof(double);
+}
+
+SolutionCache::SolutionCache(std::size_t maxBytes, std::string directory) :
+    _bytes(0),
+    _maxBytes(maxBytes),
+    _directory(directory),
+    _hits(0),
+    _misses(0)
+{
+}
+
+std::string SolutionCache::filename(const std::string &key) const
+{
+    return _directory + "/" + key + ".sol";
+}
+
+void SolutionCache::shrink()
+{
+    while (_bytes > _maxBytes && _entries.size() > 1)
+    {
+        _bytes -= _entries.back().second->bytes();
+        _index.erase(_entries.back().first);
+        _entries.pop_back();
+    }
+}
+
+void SolutionCache::remember(const std::string &key,
+        CachedSolutionPtr solution)
+{
+    #pragma omp critical(solutionCache)
+    {
+        std::map< std::string, Entries::iterator >::iterator it =
+            _index.find(key);
+        if (it != _index.end())
+        {
+            _bytes -= it->second->second->bytes();
+            _entries.erase(it->second);
+        }
+        _entries.push_front(std::make_pair(key, solution));
+        _index[key] = _entries.begin();
+        _bytes += solution->bytes();
+        shrink();
+    }
+}
+
+// Reads a result written by SolutionCache::insert (empty if the file is
+// missing, of another version or truncated)
+static CachedSolutionPtr readFile(const std::string &filename)
+{
+    if (access(filename.c_str(), R_OK) != 0)
+    {
+        return CachedSolutionPtr();
+    }
+    try
+    {
+        MappedFile file(filename);
+        CacheFileHeader header;
+        if (file.size() < sizeof(header))
+        {
+            return CachedSolutionPtr();
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        uint64_t numValues = 2 * (header.numCols + header.numRows);
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+                || header.version != VERSION
+                || header.numCols > file.size() || header.numRows > file.size()
+                || file.size() != sizeof(header) + numValues * sizeof(double))
+        {
+            return CachedSolutionPtr();
+        }
+        boost::shared_ptr< CachedSolution > solution(new CachedSolution());
+        solution->statuses = header.statuses;
+        solution->objValue = header.objValue;
+        const double * values = reinterpret_cast< const double * >(
+                file.data() + sizeof(header));
+        Values * vectors[] = {&solution->colSolution,
+            &solution->reducedCost, &solution->rowPrice,
+            &solution->rowActivity};
+        for (int v = 0; v < 4; ++v)
+        {
+            std::size_t size = (v < 2) ? header.numCols : header.numRows;
+            vectors[v]->assign(values, values + size);
+            values += size;
+        }
+        return solution;
+    }
+    catch (std::exception &)
+    {
+        return CachedSolutionPtr();
+    }
+}
+
+CachedSolutionPtr SolutionCache::find(const std::string &key)
+{
+    CachedSolutionPtr res;
+    #pragma omp critical(solutionCache)
+    {
+        std::map< std::string, Entries::iterator >::iterator it =
+            _index.find(key);
+        if (it != _index.end())
+        {
+            res = it->second->second;
+            // most recently used
+            _entries.splice(_entries.begin(), _entries, it->second);
+        }
+    }
+    if (!res && !_directory.empty())
+    {
+        res = readFile(filename(key));
+        if (res)
+        {
+            remember(key, res);
+        }
+    }
+    #pragma omp critical(solutionCache)
+    {
+        if (res)
+        {
+            ++_hits;
+        }
+        else
+        {
+            ++_misses;
+        }
+    }
+    return res;
+}
+
+void SolutionCache::insert(const std::string &key,
+        CachedSolutionPtr solution)
+{
+    remember(key, solution);
+    if (_directory.empty())
+    {
+        return;
+    }
+    CacheFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.statuses = solution->statuses;
+    header.objValue = solution->objValue;
+    header.numCols = solution->colSolution.size();
+    header.numRows = solution->rowPrice.size();
+    // written aside, then renamed: readers never see a partial file
+    std::string name = filename(key);
+    static int numWrites = 0;
+    int write;
+    #pragma omp critical(solutionCache)
+    write = numWrites++;
+    char suffix[48];
+    std::sprintf(suffix, ".%ld.%d.tmp", static_cast< long >(getpid()), write);
+    std::string temporary = name + suffix;
+    std::FILE * file = std::fopen(temporary.c_str(), "wb");
+    if (file == NULL)
+    {
+        throw std::runtime_error("Can not open " + temporary + ": "
+                + std::strerror(errno));
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    const Values * vectors[] = {&solution->colSolution,
+        &solution->reducedCost, &solution->rowPrice, &solution->rowActivity};
+    for (int v = 0; v < 4 && ok; ++v)
+    {
+        const Values &values = *vectors[v];
+        ok = values.empty() || std::fwrite(&values[0], sizeof(double),
+                values.size(), file) == values.size();
+    }
+    if (std::fclose(file) != 0 || !ok
+            || std::rename(temporary.c_str(), name.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Can not write " + name);
+    }
+}
+
+void SolutionCache::clear()
+{
+    #pragma omp critical(solutionCache)
+    {
+        _entries.clear();
+        _index.clear();
+        _bytes = 0;
+    }
+}
+
+std::size_t SolutionCache::size() const
+{
+    std::size_t res;
+    #pragma omp critical(solutionCache)
+    res = _entries.size();
+    return res;
+}
+
+std::size_t SolutionCache::getBytes() const
+{
+    std::size_t res;
+    #pragma omp critical(solutionCache)
+    res = _bytes;
+    return res;
+}
+
+std::size_t SolutionCache::getMaxBytes() const
+{
+    std::size_t res;
+    #pragma omp critical(solutionCache)
+    res = _maxBytes;
+    return res;
+}
+
+void SolutionCache::setMaxBytes(std::size_t maxBytes)
+{
+    #pragma omp critical(solutionCache)
+    {
+        _maxBytes = maxBytes;
+        shrink();
+    }
+}
+
+std::string SolutionCache::getDirectory() const
+{
+    return _directory;
+}
+
+int SolutionCache::getHits() const
+{
+    int res;
+    #pragma omp critical(solutionCache)
+    res = _hits;
+    return res;
+}
+
+int SolutionCache::getMisses() const
+{
+    int res;
+    #pragma omp critical(solutionCache)
+    res = _misses;
+    return res;
+}
@@ -0,0 +1,104 @@
+#ifndef SOLUTIONCACHE_HPP
+#define SOLUTIONCACHE_HPP
+
+/// @file:          SolutionCache.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <list>
+#include <map>
+#include <boost/shared_ptr.hpp>
+#include "CArrays.hpp"
+
+// What a solve returned, as Problem replays it on a cache hit
+struct CachedSolution
+{
+    // Bits of the statuses (see the CACHED_* constants of Problem.cpp)
+    unsigned int statuses;
+
+    double objValue;
+
+    Values colSolution;
+
+    Values reducedCost;
+
+    Values rowPrice;
+
+    Values rowActivity;
+
+    CachedSolution() : statuses(0), objValue(0) {}
+
+    // Bytes held by the vectors
+    std::size_t bytes() const;
+};
+
+typedef boost::shared_ptr< const CachedSolution > CachedSolutionPtr;
+
+// Results of earlier solves, by key (see Problem::setSolutionCache). The
+// most recently used ones are kept in memory, up to maxBytes of vectors.
+// If directory is not empty, every result is also written there (one
+// file per key) and the results missing from memory are mapped back from
+// it, so that the cache survives the process and can be shared by
+// several of them. The cache can be used by several threads.
+class SolutionCache
+{
+    private:
+        typedef std::list< std::pair< std::string, CachedSolutionPtr > >
+            Entries;
+
+        // most recently used first
+        Entries _entries;
+
+        std::map< std::string, Entries::iterator > _index;
+
+        std::size_t _bytes;
+
+        std::size_t _maxBytes;
+
+        std::string _directory;
+
+        int _hits;
+
+        int _misses;
+
+        // Evicts the least recently used entries while there are more
+        // than maxBytes (the most recent one is always kept)
+        void shrink();
+
+        // Inserts in memory only
+        void remember(const std::string &key, CachedSolutionPtr solution);
+
+        std::string filename(const std::string &key) const;
+
+    public:
+        SolutionCache(std::size_t maxBytes, std::string directory);
+
+        // The result stored for the key (memory first, then the
+        // directory), or an empty pointer. Unreadable files are misses.
+        CachedSolutionPtr find(const std::string &key);
+
+        // Stores the result. Throws a runtime_error if it can not be
+        // written in the directory.
+        void insert(const std::string &key, CachedSolutionPtr solution);
+
+        // Forgets the results in memory (the files are kept)
+        void clear();
+
+        // Number of results in memory
+        std::size_t size() const;
+
+        std::size_t getBytes() const;
+
+        std::size_t getMaxBytes() const;
+
+        void setMaxBytes(std::size_t maxBytes);
+
+        std::string getDirectory() const;
+
+        int getHits() const;
+
+        int getMisses() const;
+};
+
+#endif /* SOLUTIONCACHE_HPP*/
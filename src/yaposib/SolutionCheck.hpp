@@ -0,0 +1,44 @@
+#ifndef SOLUTIONCHECK_HPP
+#define SOLUTIONCHECK_HPP
+
+/// @file:          SolutionCheck.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+// Violations of a candidate column solution (see Problem::checkSolution).
+// A violation is the distance to the bounds (to the nearest integer for
+// the integrality), it is counted if it exceeds the tolerance.
+struct SolutionCheck
+{
+    double maxRowViolation;
+
+    double sumRowViolations;
+
+    int numRowViolations;
+
+    double maxBoundViolation;
+
+    double sumBoundViolations;
+
+    int numBoundViolations;
+
+    double maxIntegralityViolation;
+
+    double sumIntegralityViolations;
+
+    int numIntegralityViolations;
+
+    // Objective of the candidate as OSI reports it (offset subtracted)
+    double objValue;
+
+    // No violation above the tolerance
+    bool feasible;
+
+    SolutionCheck() :
+        maxRowViolation(0), sumRowViolations(0), numRowViolations(0),
+        maxBoundViolation(0), sumBoundViolations(0), numBoundViolations(0),
+        maxIntegralityViolation(0), sumIntegralityViolations(0),
+        numIntegralityViolations(0), objValue(0), feasible(true) {}
+};
+
+#endif /* SOLUTIONCHECK_HPP*/
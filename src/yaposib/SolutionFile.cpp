@@ -0,0 +1,161 @@
+#include "SolutionFile.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// std includes
+#include <stdexcept>
+#include <algorithm>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#include "FormatNumber.hpp"
+
+// Text (CSV lines, npy strings) is written by blocks of that size
+static const std::size_t WRITE_BLOCK = 1 << 20;
+
+// The header of the .npy format (version 1.0) of size elements of the
+// given type, padded so that the data starts on 64 bytes
+static std::string npyHeader(std::string descr, std::size_t size)
+{
+    std::ostringstream dict;
+    dict << "{'descr': '" << descr
+        << "', 'fortran_order': False, 'shape': (" << size << ",), }";
+    std::string header = dict.str();
+    // magic (6), version (2), header length (2), then the dictionary
+    // ended by a new line
+    std::size_t total = (10 + header.size() + 1 + 63) / 64 * 64;
+    header.append(total - 10 - header.size() - 1, ' ');
+    header += '\n';
+    std::size_t length = header.size();
+    std::string res("\x93NUMPY\x01\x00", 8);
+    res += static_cast< char >(length & 0xff);
+    res += static_cast< char >(length >> 8);
+    return res + header;
+}
+
+static std::FILE * openFile(const std::string &filename)
+{
+    std::FILE * file = std::fopen(filename.c_str(), "wb");
+    if (file == NULL)
+    {
+        throw std::runtime_error("Can not open " + filename + ": "
+                + std::strerror(errno));
+    }
+    return file;
+}
+
+static bool writeAll(std::FILE * file, const void * data, std::size_t size)
+{
+    return size == 0 || std::fwrite(data, 1, size, file) == size;
+}
+
+static void closeFile(std::FILE * file, const std::string &filename, bool ok)
+{
+    if (std::fclose(file) != 0 || !ok)
+    {
+        throw std::runtime_error("Can not write " + filename);
+    }
+}
+
+void SolutionFile::writeNpy(std::string filename, const double * values,
+        std::size_t size)
+{
+    const unsigned short probe = 1;
+    bool littleEndian = (*reinterpret_cast< const char * >(&probe) == 1);
+    std::string header = npyHeader(littleEndian ? "<f8" : ">f8", size);
+    std::FILE * file = openFile(filename);
+    bool ok = writeAll(file, header.data(), header.size())
+        && writeAll(file, values, size * sizeof(double));
+    closeFile(file, filename, ok);
+}
+
+void SolutionFile::writeNpy(std::string filename,
+        const std::vector< std::string > &strings)
+{
+    std::size_t length = 1;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+    {
+        length = std::max(length, strings[i].size());
+    }
+    std::ostringstream descr;
+    descr << "|S" << length;
+    std::string header = npyHeader(descr.str(), strings.size());
+    std::FILE * file = openFile(filename);
+    bool ok = writeAll(file, header.data(), header.size());
+    // padded with NULs
+    std::string block;
+    for (std::size_t i = 0; ok && i < strings.size(); ++i)
+    {
+        block += strings[i];
+        block.append(length - strings[i].size(), '\0');
+        if (block.size() >= WRITE_BLOCK || i + 1 == strings.size())
+        {
+            ok = writeAll(file, block.data(), block.size());
+            block.clear();
+        }
+    }
+    closeFile(file, filename, ok);
+}
+
+void SolutionFile::writeCsv(std::string filename,
+        const std::vector< std::string > &names,
+        const std::vector< Column > &columns, std::size_t size)
+{
+    std::string block;
+    if (!names.empty())
+    {
+        block += "name";
+    }
+    for (std::size_t k = 0; k < columns.size(); ++k)
+    {
+        block += (k == 0 && names.empty()) ? "" : ",";
+        block += csvField(columns[k].name);
+    }
+    block += "\n";
+    std::FILE * file = openFile(filename);
+    bool ok = true;
+    for (std::size_t i = 0; ok && i < size; ++i)
+    {
+        if (!names.empty())
+        {
+            block += csvField(names[i]);
+        }
+        for (std::size_t k = 0; k < columns.size(); ++k)
+        {
+            if (k > 0 || !names.empty())
+            {
+                block += ',';
+            }
+            appendNumber(block, columns[k].values[i]);
+        }
+        block += '\n';
+        if (block.size() >= WRITE_BLOCK)
+        {
+            ok = writeAll(file, block.data(), block.size());
+            block.clear();
+        }
+    }
+    ok = ok && writeAll(file, block.data(), block.size());
+    closeFile(file, filename, ok);
+}
+
+std::string SolutionFile::csvField(const std::string &value)
+{
+    if (value.find_first_of(",\"\r\n") == std::string::npos)
+    {
+        return value;
+    }
+    std::string res = "\"";
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        res += value[i];
+        if (value[i] == '"')
+        {
+            res += '"';
+        }
+    }
+    return res + "\"";
+}
@@ -0,0 +1,47 @@
+#ifndef SOLUTIONFILE_HPP
+#define SOLUTIONFILE_HPP
+
+/// @file:          SolutionFile.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// Files of solution vectors, written in a single pass from C++
+class SolutionFile
+{
+    public:
+        // A vector and the name it is exported under
+        struct Column
+        {
+            std::string name;
+
+            const double * values;
+        };
+
+        // Writes the values as a one dimensional .npy array of doubles
+        // (numpy.load reads it, and so does any reader skipping the
+        // header, whose size is a multiple of 64 bytes). Throws a
+        // runtime_error if the file can not be written.
+        static void writeNpy(std::string filename, const double * values,
+                std::size_t size);
+
+        // Writes the strings as a one dimensional .npy array of bytes
+        // (dtype "S<length of the longest>")
+        static void writeNpy(std::string filename,
+                const std::vector< std::string > &strings);
+
+        // Writes a CSV table of size lines: the names (if not empty),
+        // then the columns, with a header. Numbers are written with as
+        // many digits as needed to read them back exactly.
+        static void writeCsv(std::string filename,
+                const std::vector< std::string > &names,
+                const std::vector< Column > &columns, std::size_t size);
+
+        // The value, quoted if CSV needs it
+        static std::string csvField(const std::string &value);
+};
+
+#endif /* SOLUTIONFILE_HPP*/
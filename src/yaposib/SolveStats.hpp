@@ -0,0 +1,55 @@
+#ifndef SOLVESTATS_HPP
+#define SOLVESTATS_HPP
+
+/// @file:          SolveStats.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+
+// What the last call to Problem::solve cost. Times are in seconds. CPU
+// times are the ones of the calling thread (threads the solver starts on
+// its own are not counted), while the resident set size is the one of
+// the whole process.
+struct SolveStats
+{
+    // How the continuous problem was solved: "initialSolve", "resolve"
+    // or "hotStart" ("" before the first solve)
+    std::string lpPhase;
+
+    double lpWallTime;
+
+    double lpCpuTime;
+
+    // Branch and bound (0 when the solve did not consider the MIP)
+    double mipWallTime;
+
+    double mipCpuTime;
+
+    // Simplex iterations of the continuous solve, then of the branch and
+    // bound when it was done
+    int lpIterations;
+
+    int mipIterations;
+
+    // Number of nodes of the branch and bound (-1 if the solver does not
+    // say)
+    int nodes;
+
+    // Growth of the peak resident set size of the process during the
+    // solve, in kilobytes. Problems solved in parallel are not told
+    // apart.
+    long peakRssDelta;
+
+    // Wall time elapsed between the end of the previous solve (or the
+    // creation of the problem) and this one: building the model, the
+    // binding layer and the caller
+    double modelTime;
+
+    SolveStats() :
+        lpWallTime(0), lpCpuTime(0), mipWallTime(0), mipCpuTime(0),
+        lpIterations(0), mipIterations(0), nodes(-1), peakRssDelta(0),
+        modelTime(0) {}
+};
+
+#endif /* SOLVESTATS_HPP*/
@@ -0,0 +1,369 @@
+#include "SolverPool.hpp"
+
+/// @author agent <agent@local>
+/// created the 2026-10-19
+
+// OSI includes
+#include <coin/OsiSolverInterface.hpp>
+#ifdef Cbc
+#include <coin/OsiCbcSolverInterface.hpp>
+#endif
+#ifdef Clp
+#include <coin/OsiClpSolverInterface.hpp>
+#endif
+#ifdef Cpx
+#include <coin/OsiCpxSolverInterface.hpp>
+#endif
+#ifdef Dylp
+#include <coin/OsiDylpSolverInterface.hpp>
+#endif
+#ifdef Fmp
+#include <coin/OsiFmpSolverInterface.hpp>
+#endif
+#ifdef Glpk
+#include <coin/OsiGlpkSolverInterface.hpp>
+#endif
+#ifdef Grb
+#include <coin/OsiGrbSolverInterface.hpp>
+#endif
+#ifdef Msk
+#include <coin/OsiMskSolverInterface.hpp>
+#endif
+#ifdef Osl
+#include <coin/OsiOslSolverInterface.hpp>
+#endif
+#ifdef Spx
+#include <coin/OsiSpxSolverInterface.hpp>
+#endif
+#ifdef Sym
+#include <coin/OsiSymSolverInterface.hpp>
+#endif
+#ifdef Vol
+#include <coin/OsiVolSolverInterface.hpp>
+#endif
+#ifdef Xpr
+#include <coin/OsiXprSolverInterface.hpp>
+#endif
+
+// std includes
+#include <map>
+#include <stdexcept>
+
+template <class T>
+static OsiSolverInterface * build()
+{
+    return new T();
+}
+
+// One entry per solver yaposib was compiled with
+struct SolverEntry
+{
+    const char * name;
+
+    OsiSolverInterface * (*build)();
+
+    // does the interface implement a branch and bound?
+    bool mip;
+};
+
+static const SolverEntry SOLVERS[] = {
+#ifdef Cbc
+    {"Cbc", &build<OsiCbcSolverInterface>, true},
+#endif
+#ifdef Clp
+    {"Clp", &build<OsiClpSolverInterface>, false},
+#endif
+#ifdef Cpx
+    {"Cpx", &build<OsiCpxSolverInterface>, true},
+#endif
+#ifdef Dylp
+    {"Dylp", &build<OsiDylpSolverInterface>, false},
+#endif
+#ifdef Fmp
+    {"Fmp", &build<OsiFmpSolverInterface>, true},
+#endif
+#ifdef Glpk
+    {"Glpk", &build<OsiGlpkSolverInterface>, true},
+#endif
+#ifdef Grb
+    {"Grb", &build<OsiGrbSolverInterface>, true},
+#endif
+#ifdef Msk
+    {"Msk", &build<OsiMskSolverInterface>, true},
+#endif
+#ifdef Osl
+    {"Osl", &build<OsiOslSolverInterface>, true},
+#endif
+#ifdef Spx
+    {"Spx", &build<OsiSpxSolverInterface>, false},
+#endif
+#ifdef Sym
+    {"Sym", &build<OsiSymSolverInterface>, true},
+#endif
+#ifdef Vol
+    {"Vol", &build<OsiVolSolverInterface>, false},
+#endif
+#ifdef Xpr
+    {"Xpr", &build<OsiXprSolverInterface>, true},
+#endif
+    {NULL, NULL, false}
+};
+
+struct PoolState
+{
+    // idle interfaces, by solver name
+    std::map< std::string, std::vector< OsiSolverInterface * > > idle;
+
+    // result of the instanciation probe, by solver name
+    std::map< std::string, bool > probed;
+
+    int capacity;
+
+    PoolState() : capacity(0) {}
+};
+
+// Never destroyed: a Problem may release its interface after the static
+// objects are gone. It is only accessed in the critical section
+// solverPool, so that problems can be built and destroyed by several
+// threads (see BatchSolver). Solvers are built, reset and destroyed out
+// of it, and nothing in it throws.
+static PoolState & state()
+{
+    static PoolState * res = new PoolState();
+    return *res;
+}
+
+// Deleter of the pointers handed out by SolverPool::acquire
+struct SolverReleaser
+{
+    std::string solverName;
+
+    SolverReleaser(std::string name) : solverName(name) {}
+
+    void operator()(OsiSolverInterface * solver) const
+    {
+        SolverPool::release(solverName, solver);
+    }
+};
+
+std::vector<std::string> SolverPool::compiledSolvers()
+{
+    std::vector<std::string> res;
+    for (int i = 0; SOLVERS[i].name != NULL; ++i)
+    {
+        res.push_back(SOLVERS[i].name);
+    }
+    return res;
+}
+
+std::vector<std::string> SolverPool::availableSolvers()
+{
+    std::vector<std::string> res;
+    for (int i = 0; SOLVERS[i].name != NULL; ++i)
+    {
+        if (isAvailable(SOLVERS[i].name))
+        {
+            res.push_back(SOLVERS[i].name);
+        }
+    }
+    return res;
+}
+
+bool SolverPool::isAvailable(std::string solverName)
+{
+    bool probed = false;
+    bool available = false;
+    #pragma omp critical(solverPool)
+    {
+        std::map< std::string, bool >::iterator it =
+            state().probed.find(solverName);
+        if (it != state().probed.end())
+        {
+            probed = true;
+            available = it->second;
+        }
+    }
+    if (probed)
+    {
+        return available;
+    }
+    OsiSolverInterface * solver = NULL;
+    try
+    {
+        solver = create(solverName);
+    }
+    catch (...)
+    {
+        solver = NULL;
+    }
+    available = (solver != NULL);
+    #pragma omp critical(solverPool)
+    state().probed[solverName] = available;
+    if (solver != NULL)
+    {
+        release(solverName, solver);
+    }
+    return available;
+}
+
+bool SolverPool::supportsMip(std::string solverName)
+{
+    for (int i = 0; SOLVERS[i].name != NULL; ++i)
+    {
+        if (solverName == SOLVERS[i].name)
+        {
+            return SOLVERS[i].mip;
+        }
+    }
+    return false;
+}
+
+SolverPtr SolverPool::acquire(std::string solverName)
+{
+    OsiSolverInterface * solver = NULL;
+    #pragma omp critical(solverPool)
+    {
+        std::vector< OsiSolverInterface * > & idle = state().idle[solverName];
+        if (!idle.empty())
+        {
+            solver = idle.back();
+            idle.pop_back();
+        }
+    }
+    if (solver == NULL)
+    {
+        solver = create(solverName);
+    }
+    if (solver == NULL)
+    {
+        throw std::runtime_error( solverName + ": Unknown _solver");
+    }
+    return SolverPtr(solver, SolverReleaser(solverName));
+}
+
+void SolverPool::prewarm(std::string solverName, int count)
+{
+    // before the pool gets an entry for the name
+    if (!isAvailable(solverName))
+    {
+        throw std::runtime_error( solverName + ": Unknown _solver");
+    }
+    int missing;
+    #pragma omp critical(solverPool)
+    {
+        if (count > state().capacity)
+        {
+            state().capacity = count;
+        }
+        missing = count
+            - static_cast< int >(state().idle[solverName].size());
+    }
+    for (; missing > 0; --missing)
+    {
+        OsiSolverInterface * solver = create(solverName);
+        if (solver == NULL)
+        {
+            throw std::runtime_error( solverName + ": Unknown _solver");
+        }
+        #pragma omp critical(solverPool)
+        state().idle[solverName].push_back(solver);
+    }
+}
+
+int SolverPool::getCapacity()
+{
+    int capacity;
+    #pragma omp critical(solverPool)
+    capacity = state().capacity;
+    return capacity;
+}
+
+void SolverPool::setCapacity(int capacity)
+{
+    if (capacity < 0)
+    {
+        throw std::runtime_error("The capacity can not be negative");
+    }
+    std::vector< OsiSolverInterface * > removed;
+    #pragma omp critical(solverPool)
+    {
+        state().capacity = capacity;
+        std::map< std::string, std::vector< OsiSolverInterface * > >::iterator it;
+        for (it = state().idle.begin(); it != state().idle.end(); ++it)
+        {
+            while ((int)it->second.size() > capacity)
+            {
+                removed.push_back(it->second.back());
+                it->second.pop_back();
+            }
+        }
+    }
+    for (std::size_t i = 0; i < removed.size(); ++i)
+    {
+        delete removed[i];
+    }
+}
+
+int SolverPool::size(std::string solverName)
+{
+    int size;
+    #pragma omp critical(solverPool)
+    size = state().idle[solverName].size();
+    return size;
+}
+
+void SolverPool::clear()
+{
+    std::vector< OsiSolverInterface * > removed;
+    #pragma omp critical(solverPool)
+    {
+        std::map< std::string, std::vector< OsiSolverInterface * > >::iterator it;
+        for (it = state().idle.begin(); it != state().idle.end(); ++it)
+        {
+            removed.insert(removed.end(), it->second.begin(), it->second.end());
+            it->second.clear();
+        }
+    }
+    for (std::size_t i = 0; i < removed.size(); ++i)
+    {
+        delete removed[i];
+    }
+}
+
+OsiSolverInterface * SolverPool::create(std::string solverName)
+{
+    for (int i = 0; SOLVERS[i].name != NULL; ++i)
+    {
+        if (solverName == SOLVERS[i].name)
+        {
+            return SOLVERS[i].build();
+        }
+    }
+    return NULL;
+}
+
+void SolverPool::release(std::string solverName, OsiSolverInterface * solver)
+{
+    bool keep;
+    #pragma omp critical(solverPool)
+    keep = ((int)state().idle[solverName].size() < state().capacity);
+    if (keep)
+    {
+        // interfaces which can not be reset are not reused
+        try
+        {
+            solver->reset();
+        }
+        catch (...)
+        {
+            keep = false;
+        }
+    }
+    if (keep)
+    {
+        #pragma omp critical(solverPool)
+        state().idle[solverName].push_back(solver);
+        return;
+    }
+    delete solver;
+}
@@ -0,0 +1,72 @@
+#ifndef SOLVERPOOL_HPP
+#define SOLVERPOOL_HPP
+
+/// @file:          SolverPool.hpp
+/// @author:        agent <agent@local>
+/// @created:       2026-10-19
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+// forward declarations
+class OsiSolverInterface;
+
+// typedefs
+typedef boost::shared_ptr<OsiSolverInterface> SolverPtr;
+
+// Registry of the solvers yaposib was compiled with, and pool of idle
+// solver interfaces. Constructing an interface is not free (some
+// solvers open an environment or check a license), so released
+// interfaces are reset and kept for the next Problem instead of being
+// destroyed.
+class SolverPool
+{
+    public:
+        // Names of the solvers yaposib was compiled with
+        static std::vector<std::string> compiledSolvers();
+
+        // Names of the solvers that can actually be instanciated. Each
+        // solver is probed once per process, the probe instance is
+        // kept in the pool.
+        static std::vector<std::string> availableSolvers();
+
+        // Can the given solver be instanciated?
+        static bool isAvailable(std::string solverName);
+
+        // Does the given solver implement a branch and bound?
+        static bool supportsMip(std::string solverName);
+
+        // Returns an interface of the given solver, taken from the pool
+        // if one is idle, built otherwise. It goes back to the pool (or
+        // is destroyed if the pool is full) when the last pointer to it
+        // is released.
+        static SolverPtr acquire(std::string solverName);
+
+        // Builds interfaces of the given solver until count of them are
+        // idle. Raises the capacity if needed.
+        static void prewarm(std::string solverName, int count);
+
+        // Maximum number of idle interfaces kept per solver (0 by
+        // default: no pooling)
+        static int getCapacity();
+
+        static void setCapacity(int capacity);
+
+        // Number of idle interfaces of the given solver
+        static int size(std::string solverName);
+
+        // Destroys every idle interface
+        static void clear();
+
+    private:
+        // Builds a fresh interface (NULL if the solver is unknown)
+        static OsiSolverInterface * create(std::string solverName);
+
+        // Resets the interface and keeps it, or destroys it
+        static void release(std::string solverName, OsiSolverInterface * solver);
+
+        friend struct SolverReleaser;
+};
+
+#endif /* SOLVERPOOL_HPP*/
@@ -1,28 +1,27 @@
 import _yaposib
 import exceptions
 
-class YaposibError(exceptions.Exception):
+class YaposibError(exceptions.RuntimeError):
     def __init__(self, error_str = ""):
         self.error_str = error_str
     def __str__(self):
         return self.error_str
 
+# invalid models read by the native readers raise YaposibError
+_yaposib.setErrorClass(YaposibError)
+
 def vec(listOfPairs):
-    vec = _yaposib.CoinPackedVector()
-    for pair in listOfPairs:
-        try:
-            vec.insert(pair[0], pair[1])
-        except:
-            raise YaposibError("Error inserting element in vector. Twice the same index?")
-    return vec
+    if not isinstance(listOfPairs, (list, tuple)):
+        listOfPairs = list(listOfPairs)
+    try:
+        return _yaposib.CoinPackedVector.fromPairs(listOfPairs)
+    except (TypeError, IndexError):
+        raise YaposibError("Error inserting element in vector. Not an (index, value) pair?")
+    except RuntimeError as e:
+        raise YaposibError("Error inserting element in vector. %s" % e)
 
 def available_solvers():
-    res = []
-    for solver in ["Cbc", "Clp", "Cpx", "Dylp", "Fmp", "Glpk", "Grb",
-            "Msk", "Osl", "Spx", "Sym", "Vol", "Xpr"]:
-        try:
-            prob = _yaposib.Problem(solver)
-            res.append(solver)
-        except:
-            pass
-    return res
+    return list(_yaposib.SolverPool.availableSolvers())
+
+def available_compressions():
+    return list(_yaposib.availableCompressions())
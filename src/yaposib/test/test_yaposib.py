@@ -1,10 +1,16 @@
 #!env python
 import unittest
+import struct
 try:
     import src.yaposib as yaposib
 except:
     import coinor.yaposib as yaposib
 
+def view_to_list(view):
+    """Reads the values of a read-only view given to a callback"""
+    data = bytes(view)
+    return list(struct.unpack("%dd" % (len(data) // 8), data))
+
 def yaposibTestCheck(prob, okstatus, sol = {},
                    reducedcosts = None,
                    duals = None,
@@ -702,6 +708,770 @@ class TestYaposib(unittest.TestCase):
     def test_isIterationLimitReached(self):
         pass
 
+    def test_mipEvents(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            prob.mipEventInterval = 1
+            kinds = []
+            prob.setMipEventCallback(lambda event: kinds.append(event.kind))
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            events = prob.pollMipEvents()
+            if kinds[-1] != "finished" or events[-1].kind != "finished":
+                raise yaposib.YaposibError("Missing 'finished' event")
+            if len(prob.pollMipEvents()) != 0:
+                raise yaposib.YaposibError("Events were polled twice")
+
+    def test_mipStart(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            # a feasible, but not optimal start
+            prob.setMipStart([0, 1, 2], [4.0, 0.5, 8.0])
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            # an infeasible start must be ignored
+            prob = mip(solver)
+            prob.setMipStart([0, 2], [100.0, -3.0])
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            prob.clearMipStart()
+            try:
+                prob.setMipStart([0, 3], [1.0, 1.0])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Out of range start accepted")
+            # the start follows the columns when one is deleted
+            prob = mip(solver)
+            col = prob.cols.add(yaposib.vec([]))
+            col.lowerbound = 0
+            col.upperbound = 1
+            prob.setMipStart([0, 1, 2, 3], [4.0, 0.5, 8.0, 1.0])
+            del prob.cols[0]
+            if list(prob.mipStartIndices) != [0, 1, 2] \
+                    or list(prob.mipStartValues) != [0.5, 8.0, 1.0]:
+                raise yaposib.YaposibError("MIP start not renumbered")
+            # without x, c2 becomes z >= 8
+            prob.rows[1].lowerbound = 8
+            prob.solve(True)
+            if prob.status != "optimal" \
+                    or abs(prob.cols[1].solution - 8.0) > 10**-6:
+                raise yaposib.YaposibError("Wrong solve after deletion")
+
+    def test_solveLexicographic(self):
+        def square(solver):
+            # maximize x, then y, with x + y <= 10 and 0 <= x, y <= 10
+            prob = yaposib.Problem(solver)
+            prob.obj.maximize = True
+            for i in range(2):
+                prob.cols.add(yaposib.vec([]))
+                prob.cols[i].lowerbound = 0
+                prob.cols[i].upperbound = 10
+            prob.rows.add(yaposib.vec([(0,1),(1,1)]))
+            prob.rows[0].upperbound = 10
+            return prob
+        for solver in yaposib.available_solvers():
+            prob = square(solver)
+            stages = prob.solveLexicographic([yaposib.vec([(0,1)]), [0, 1]])
+            if stages != 2 or len(prob.rows) != 2:
+                raise yaposib.YaposibError("Stages were not all solved")
+            if prob.rows[1].name != "lex_0":
+                raise yaposib.YaposibError("Bound row was not named")
+            yaposibTestCheck(prob, ["optimal"], sol = [10.0, 0.0])
+            # x may lose half of its value
+            del prob.rows[1]
+            stages = prob.solveLexicographic([[1, 0], [0, 1]], [0.5])
+            yaposibTestCheck(prob, ["optimal"], sol = [5.0, 5.0])
+            # the offset is not part of the bound row
+            for offset in [5, -5]:
+                prob = square(solver)
+                prob.objOffset = offset
+                stages = prob.solveLexicographic([[1, 0], [0, 1]])
+                if stages != 2:
+                    raise yaposib.YaposibError("Second stage infeasible")
+                yaposibTestCheck(prob, ["optimal"], sol = [10.0, 0.0])
+            # the first stage from the cache bounds x with its value
+            cache = yaposib.SolutionCache()
+            first = square(solver)
+            first.obj[0] = 1
+            first.solutionCache = cache
+            first.solve()
+            prob = square(solver)
+            prob.solutionCache = cache
+            prob.solveLexicographic([[1, 0], [0, 1]])
+            if cache.hits != 1:
+                raise yaposib.YaposibError("First stage was not cached")
+            yaposibTestCheck(prob, ["optimal"], sol = [10.0, 0.0])
+
+    def test_stats(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            if prob.stats.lpPhase != "":
+                raise yaposib.YaposibError("Stats before the first solve")
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            stats = prob.stats
+            if stats.lpPhase != "initialSolve" or stats.modelTime < 0:
+                raise yaposib.YaposibError("Bad continuous solve stats")
+            if stats.lpWallTime < 0 or stats.mipWallTime < 0:
+                raise yaposib.YaposibError("Bad times")
+            prob.solve(False)
+            if prob.stats.lpPhase != "resolve" or prob.stats.mipWallTime != 0:
+                raise yaposib.YaposibError("Bad resolve stats")
+
+    def test_readMpsNative(self):
+        for solver in yaposib.available_solvers():
+            mip(solver).writeMps("native")
+            prob = yaposib.Problem(solver)
+            prob.readMpsNative("native.mps")
+            if not prob.cols[2].integer or prob.rows[0].name != "c1":
+                raise yaposib.YaposibError("Model was not read back")
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            prob.readMpsNative("native.mps", numThreads = 2)
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            with open("broken.mps", "w") as f:
+                f.write("NAME broken\nROWS\n N obj\nCOLUMNS\n    x c 1\n")
+            try:
+                prob.readMpsNative("broken.mps")
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Unknown row accepted")
+            with open("broken.mps", "w") as f:
+                f.write("NAME broken\nROWS\n N obj\n L c\nCOLUMNS\n"
+                        "    x c nan\nENDATA\n")
+            try:
+                prob.readMpsNative("broken.mps")
+            except yaposib.YaposibError:
+                pass
+            else:
+                raise yaposib.YaposibError("NaN coefficient accepted")
+
+    def test_readMpsNativeChunks(self):
+        """
+        a model whose COLUMNS section is cut in several chunks, with long
+        columns and integer markers crossing their boundaries
+        """
+        numRows, numCols = 200, 3000
+        lines = ["NAME          chunks", "ROWS", " N  obj"]
+        for i in range(numRows):
+            lines.append(" %s  r%d" % ("LGE"[i % 3], i))
+        lines.append("COLUMNS")
+        for j in range(numCols):
+            if j % 700 == 100:
+                lines.append("    M%d  'MARKER'  'INTORG'" % j)
+            if j % 700 == 400:
+                lines.append("    M%d  'MARKER'  'INTEND'" % j)
+            if j % 5 == 0:
+                lines.append("    x%d  obj  %g" % (j, 1 + j % 7))
+            # every 97th column has an entry in every row
+            rows = range(numRows) if j % 97 == 0 else \
+                    sorted(set([(j * 7 + k * 13) % numRows for k in range(6)]))
+            for i in rows:
+                lines.append("    x%d  r%d  %g" % (j, i, (i + j) % 11 - 5.5))
+        lines.append("RHS")
+        for i in range(0, numRows, 2):
+            lines.append("    rhs  r%d  %g" % (i, i % 9 + 1))
+        lines.append("RANGES")
+        for i in range(0, numRows, 10):
+            lines.append("    rng  r%d  4" % i)
+        lines.append("BOUNDS")
+        for j in range(0, numCols, 3):
+            lines.append(" UP bnd  x%d  %d" % (j, 10 + j % 4))
+        lines.append("ENDATA")
+        with open("chunks.mps", "w") as f:
+            f.write("\n".join(lines) + "\n")
+        for solver in yaposib.available_solvers():
+            native = yaposib.Problem(solver)
+            native.readMpsNative("chunks.mps", numThreads = 4)
+            reference = yaposib.Problem(solver)
+            reference.readMps("chunks.mps")
+            if len(native.cols) != numCols or len(native.rows) != numRows \
+                    or len(reference.cols) != numCols:
+                raise yaposib.YaposibError("Wrong sizes")
+            for j in range(numCols):
+                a, b = native.cols[j], reference.cols[j]
+                if a.name != b.name or a.integer != b.integer \
+                        or a.lowerbound != b.lowerbound \
+                        or a.upperbound != b.upperbound \
+                        or native.obj[j] != reference.obj[j] \
+                        or list(a.indices) != list(b.indices) \
+                        or list(a.values) != list(b.values):
+                    raise yaposib.YaposibError("Column %d differs" % j)
+            for i in range(numRows):
+                a, b = native.rows[i], reference.rows[i]
+                if a.name != b.name or a.lowerbound != b.lowerbound \
+                        or a.upperbound != b.upperbound:
+                    raise yaposib.YaposibError("Row %d differs" % i)
+
+    def test_readLpNative(self):
+        text = """\\ the mip problem
+Minimize
+ obj: x + 4 y + 9 z
+Subject To
+ c1: x + y <= 5
+ c2: x + z >= 10
+ c3: - y + z = 7.5
+Bounds
+ x <= 4
+ -1 <= y <= 1
+General
+ z
+End
+"""
+        for solver in yaposib.available_solvers():
+            prob = yaposib.Problem(solver)
+            prob.readLpBuffer(text)
+            if not prob.cols[2].integer or prob.rows[2].name != "c3":
+                raise yaposib.YaposibError("Model was not read")
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            with open("native.lp", "w") as f:
+                f.write(text)
+            prob = yaposib.Problem(solver)
+            prob.readLpNative("native.lp")
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            try:
+                prob.readLpBuffer("Minimize\n obj: x\nSubject To\n x + y\nEnd\n")
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Constraint without bound accepted")
+            # a generated name is taken like a given one
+            try:
+                prob.readLpBuffer("Minimize\n obj: x\nSubject To\n x >= 1\n"
+                        " x >= 2\n c2: x <= 3\nEnd\n")
+            except yaposib.YaposibError:
+                pass
+            else:
+                raise yaposib.YaposibError("Duplicate row name accepted")
+            prob.readLpBuffer("Minimize\n obj: x\nSubject To\n c2: x >= 1\n"
+                    " x >= 2\nEnd\n")
+            if prob.rows[0].name == prob.rows[1].name:
+                raise yaposib.YaposibError("Duplicate generated name")
+
+    def test_compressedFiles(self):
+        extensions = {"gzip": ".gz", "bzip2": ".bz2", "zstd": ".zst"}
+        for solver in yaposib.available_solvers():
+            for compression in yaposib.available_compressions():
+                for fmt in ("mps", "lp"):
+                    name = "compressed." + fmt + extensions[compression]
+                    if fmt == "mps":
+                        mip(solver).writeMps(name)
+                    else:
+                        mip(solver).writeLp(name)
+                    prob = yaposib.Problem(solver)
+                    if fmt == "mps":
+                        prob.readMps(name)
+                    else:
+                        prob.readLp(name)
+                    if not prob.cols[2].integer or prob.rows[0].name != "c1":
+                        raise yaposib.YaposibError("Model was not read back")
+                    yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                            solve_as_MIP = True)
+
+    def test_saveLoad(self):
+        for solver in yaposib.available_solvers():
+            prob = continuous(solver)
+            prob.maxNumIterations = 1234
+            prob.solve()
+            x = [col.solution for col in prob.cols]
+            prob.save("snapshot.bin")
+            loaded = yaposib.Problem(solver)
+            loaded.load("snapshot.bin")
+            if loaded.maxNumIterations != 1234 \
+                    or loaded.rows[0].name != prob.rows[0].name \
+                    or [col.solution for col in loaded.cols] != x:
+                raise yaposib.YaposibError("State was not restored")
+            yaposibTestCheck(loaded, ["optimal"], x)
+            prob.save("snapshot.bin", withNames = False)
+            loaded.load("snapshot.bin")
+            if len(loaded.rows) != len(prob.rows):
+                raise yaposib.YaposibError("Model was not restored")
+            with open("broken.bin", "w") as f:
+                f.write("not a snapshot")
+            try:
+                loaded.load("broken.bin")
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Broken snapshot accepted")
+
+    def test_pickle(self):
+        import pickle
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            prob.solve(True)
+            copy = pickle.loads(pickle.dumps(prob, pickle.HIGHEST_PROTOCOL))
+            if copy.solverName != solver or not copy.cols[2].integer \
+                    or copy.rows[0].name != "c1":
+                raise yaposib.YaposibError("Problem was not unpickled")
+            yaposibTestCheck(copy, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+
+    def test_bytesIO(self):
+        for solver in yaposib.available_solvers():
+            source = mip(solver)
+            for data, read in ((source.toMpsBytes(), "fromMpsBytes"),
+                    (bytearray(source.toLpBytes()), "fromLpBytes")):
+                prob = yaposib.Problem(solver)
+                getattr(prob, read)(data)
+                if not prob.cols[2].integer or prob.rows[0].name != "c1":
+                    raise yaposib.YaposibError("Model was not read back")
+                yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                        solve_as_MIP = True)
+
+    def test_batchSolver(self):
+        import json
+        for solver in yaposib.available_solvers():
+            mip(solver).writeMps("batch1")
+            mip(solver).writeLp("batch2")
+            with open("batch3.mps", "w") as f:
+                f.write("NAME broken\n")
+            batch = yaposib.BatchSolver(solver)
+            batch.numThreads = 2
+            batch.solutionDir = "."
+            files = ["batch1.mps", "batch2.lp", "batch3.mps"]
+            if batch.solve(files, "results.jsonl") != 2:
+                raise yaposib.YaposibError("Instances were not solved")
+            with open("results.jsonl") as f:
+                results = [json.loads(line) for line in f]
+            results = dict((result["file"], result) for result in results)
+            if sorted(results.keys()) != files \
+                    or results["batch3.mps"]["error"] == "" \
+                    or abs(results["batch1.mps"]["objective"] - 64.0) > 1e-3 \
+                    or results["batch2.lp"]["solution"] != "./batch2.npy":
+                raise yaposib.YaposibError("Wrong results: %s" % results)
+            batch.solve(files, "results.csv")
+            with open("results.csv") as f:
+                if len(f.readlines()) != 4:
+                    raise yaposib.YaposibError("Wrong csv results")
+            # same name, different extensions: distinct solution files
+            mip(solver).writeLp("batch1")
+            files = ["batch1.mps", "batch1.lp"]
+            batch.solve(files, "results.jsonl")
+            with open("results.jsonl") as f:
+                solutions = sorted(json.loads(line)["solution"] for line in f)
+            if solutions != ["./batch1.0.npy", "./batch1.1.npy"]:
+                raise yaposib.YaposibError("Wrong solutions: %s" % solutions)
+
+    def test_exportSolution(self):
+        for solver in yaposib.available_solvers():
+            prob = continuous(solver)
+            prob.solve()
+            x = [col.solution for col in prob.cols]
+            files = prob.exportSolution("exported", what = ["primal", "dual"])
+            if files != ["exported.colnames.npy", "exported.rownames.npy",
+                    "exported.primal.npy", "exported.dual.npy"]:
+                raise yaposib.YaposibError("Wrong files: %s" % files)
+            with open("exported.primal.npy", "rb") as f:
+                data = f.read()
+            # the data starts after the (64 bytes aligned) header
+            headerLength = struct.unpack("<H", data[8:10])[0] + 10
+            values = struct.unpack("=%dd" % len(x), data[headerLength:])
+            if list(values) != x:
+                raise yaposib.YaposibError("Wrong primal: %s" % values)
+            files = prob.exportSolution("exported", "csv")
+            if files != ["exported.cols.csv", "exported.rows.csv"]:
+                raise yaposib.YaposibError("Wrong files: %s" % files)
+            with open("exported.cols.csv") as f:
+                lines = f.read().splitlines()
+            if lines[0] != "name,primal,reduced" \
+                    or len(lines) != len(x) + 1 \
+                    or lines[1].split(",")[0] != prob.cols[0].name:
+                raise yaposib.YaposibError("Wrong csv: %s" % lines)
+            try:
+                prob.exportSolution("exported", what = ["nothing"])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Unknown vector accepted")
+
+    def test_vectorFromArrays(self):
+        for solver in yaposib.available_solvers():
+            prob = yaposib.Problem(solver)
+            for i in range(3):
+                prob.cols.add(yaposib.vec([]))
+            prob.rows.add(([2, 0], [3.0, 1.0]))
+            prob.rows.add([0, 1], [1.0, 2.0])
+            prob.rows.add(yaposib.CoinPackedVector([1, 2, 1], [1.0, 1.0, 2.0],
+                coalesce = True))
+            prob.cols.add(([0, 2], [5.0, 6.0]))
+            rows = [sorted(zip(row.indices, row.values)) for row in prob.rows]
+            if rows != [[(0, 1.0), (2, 3.0), (3, 5.0)], [(0, 1.0), (1, 2.0)],
+                    [(1, 3.0), (2, 1.0), (3, 6.0)]]:
+                raise yaposib.YaposibError("Wrong rows: %s" % rows)
+            try:
+                yaposib.CoinPackedVector([1, 1], [1.0, 2.0])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Repeated index accepted")
+            try:
+                yaposib.vec([(1, 1.0), (1, 2.0)])
+            except yaposib.YaposibError:
+                pass
+            else:
+                raise yaposib.YaposibError("Repeated index accepted")
+            try:
+                yaposib.vec([(1, 1.0), (2,)])
+            except yaposib.YaposibError:
+                pass
+            else:
+                raise yaposib.YaposibError("Malformed pair accepted")
+            try:
+                yaposib.vec([(-1, 1.0)])
+            except yaposib.YaposibError as e:
+                if "Negative index" not in str(e):
+                    raise yaposib.YaposibError("Wrong message: %s" % e)
+            else:
+                raise yaposib.YaposibError("Negative index accepted")
+
+    def test_vectorFromBuffers(self):
+        import ctypes
+        # typed buffers take the fast path, copied at once
+        candidates = [((ctypes.c_int * 3)(2, 0, 1),
+                       (ctypes.c_double * 3)(3.0, 1.0, 2.0))]
+        try:
+            import numpy
+            candidates.append((numpy.array([2, 0, 1], dtype = numpy.int64),
+                               numpy.array([3.0, 1.0, 2.0])))
+            candidates.append((numpy.array([2, 0, 1], dtype = numpy.int32),
+                               numpy.array([3.0, 1.0, 2.0])))
+        except ImportError:
+            pass
+        for solver in yaposib.available_solvers():
+            prob = yaposib.Problem(solver)
+            for i in range(3):
+                prob.cols.add(yaposib.vec([]))
+            for indices, values in candidates:
+                prob.rows.add(indices, values)
+                prob.rows.add(yaposib.CoinPackedVector(indices, values))
+            for row in prob.rows:
+                entries = sorted(zip(row.indices, row.values))
+                if entries != [(0, 1.0), (1, 2.0), (2, 3.0)]:
+                    raise yaposib.YaposibError("Wrong row: %s" % entries)
+            prob.cols.add((ctypes.c_int * 1)(0), (ctypes.c_double * 1)(7.0))
+            if list(prob.cols[3].values) != [7.0]:
+                raise yaposib.YaposibError("Wrong column")
+
+    def test_memoryUsage(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            before = prob.memoryUsage()
+            prob.solve()
+            usage = prob.memoryUsage()
+            if usage.matrixByCol <= 0 or usage.matrixByRow <= 0 \
+                    or usage.bounds <= 0 or usage.handles <= 0 \
+                    or usage.total < usage.matrixByCol + usage.bounds:
+                raise yaposib.YaposibError("Wrong memory usage")
+            if before.warmStart != 0:
+                raise yaposib.YaposibError("Warm start before solving")
+
+    def test_analyze(self):
+        for solver in yaposib.available_solvers():
+            stats = mip(solver).analyze()
+            if (stats.numRows, stats.numCols, stats.numElements) != (3, 3, 6):
+                raise yaposib.YaposibError("Wrong sizes")
+            if list(stats.rowHistogram) != [0, 0, 3] \
+                    or list(stats.colHistogram) != [0, 0, 3]:
+                raise yaposib.YaposibError("Wrong histograms")
+            if stats.minCoefficient != 1 or stats.maxCoefficient != 1 \
+                    or stats.minObjective != 1 or stats.maxObjective != 9 \
+                    or stats.minRhs != 5 or stats.maxRhs != 10:
+                raise yaposib.YaposibError("Wrong ranges")
+            if stats.numIntegerCols != 1 or stats.numEqualityRows != 1 \
+                    or stats.numFreeCols != 0:
+                raise yaposib.YaposibError("Wrong counts")
+
+    def test_checkSolution(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            check = prob.checkSolution([2.5, 0.5, 8])
+            if not check.feasible or check.objValue != 76.5:
+                raise yaposib.YaposibError("Feasible solution rejected")
+            check = prob.checkSolution([5, 0, 7.25], tol=1e-9)
+            if check.feasible or check.numBoundViolations != 1 \
+                    or check.numRowViolations != 1 \
+                    or check.numIntegralityViolations != 1 \
+                    or abs(check.maxRowViolation - 0.25) > 1e-9:
+                raise yaposib.YaposibError("Wrong violations")
+            try:
+                prob.checkSolution([0, 0])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Wrong size accepted")
+            # rows are checked without columns too
+            empty = yaposib.Problem(solver)
+            empty.rows.add(yaposib.vec([]))
+            empty.rows[0].lowerbound = 1
+            empty.objOffset = 2
+            check = empty.checkSolution([])
+            if check.feasible or check.numRowViolations != 1 \
+                    or check.objValue != -2:
+                raise yaposib.YaposibError("Empty row not checked")
+
+    def test_compact(self):
+        for solver in yaposib.available_solvers():
+            prob = continuous(solver)
+            prob.solve()
+            for k in range(20):
+                prob.rows.add(yaposib.vec([(0, 1.0), (1, 1.0), (2, 1.0)]))
+                del prob.rows[len(prob.rows) - 1]
+            x = [col.solution for col in prob.cols]
+            names = [row.name for row in prob.rows]
+            prob.autoCompactRatio = 0.5
+            prob.compact()
+            if prob.matrixGapRatio != 0 \
+                    or [row.name for row in prob.rows] != names:
+                raise yaposib.YaposibError("Problem was not compacted")
+            prob.solve()
+            yaposibTestCheck(prob, ["optimal"], x)
+            if prob.stats.lpPhase != "resolve" \
+                    or prob.stats.lpIterations != 0:
+                raise yaposib.YaposibError("Basis was not kept")
+            if prob.autoCompactRatio != 0.5:
+                raise yaposib.YaposibError("Policy was not kept")
+
+    def test_scenarios(self):
+        for solver in yaposib.available_solvers():
+            model = yaposib.Model(mip(solver))
+            tight = yaposib.Scenario(model)
+            tight.setColBounds(2, 0, 6)
+            if len(tight) != 1 or tight.model.numCols != 3:
+                raise yaposib.YaposibError("Wrong scenario")
+            prob = yaposib.Problem(solver)
+            prob.loadScenario(yaposib.Scenario(model))
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            prob.loadScenario(tight)
+            prob.solve(True)
+            if prob.status == "optimal" and prob.cols[2].solution > 6 + 1e-6:
+                raise yaposib.YaposibError("Scenario was not applied")
+            # back to the model, without reloading it
+            prob.loadScenario(yaposib.Scenario(model))
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            prob.rows.add(yaposib.vec([(0, 1.0)]))
+            prob.loadScenario(tight)
+            if len(prob.rows) != model.numRows:
+                raise yaposib.YaposibError("Model was not reloaded")
+            # what the scenarios do not set is reloaded too
+            prob.obj.maximize = not prob.obj.maximize
+            prob.objOffset = 5
+            prob.cols[2].integer = not prob.cols[2].integer
+            prob.loadScenario(yaposib.Scenario(model))
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            if prob.objOffset != 0:
+                raise yaposib.YaposibError("Offset was not restored")
+
+    def test_fingerprint(self):
+        for solver in yaposib.available_solvers():
+            prob = mip(solver)
+            fingerprint = prob.fingerprint()
+            if len(fingerprint) != 32 \
+                    or mip(solver).fingerprint() != fingerprint:
+                raise yaposib.YaposibError("Wrong fingerprint")
+            structure = prob.fingerprint(["structure"])
+            prob.cols[0].upperbound = 3
+            if prob.fingerprint() == fingerprint \
+                    or prob.fingerprint(["structure"]) != structure:
+                raise yaposib.YaposibError("Bounds were not hashed alone")
+            prob.rows[0].name = "renamed"
+            prob.cols[0].upperbound = 4
+            if prob.fingerprint() != fingerprint:
+                raise yaposib.YaposibError("Names were hashed")
+            try:
+                prob.fingerprint(["names"])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Unknown part accepted")
+
+    def test_solutionCache(self):
+        import os
+        import shutil
+        for solver in yaposib.available_solvers():
+            shutil.rmtree("solutions", True)
+            os.mkdir("solutions")
+            cache = yaposib.SolutionCache(directory = "solutions")
+            prob = mip(solver)
+            prob.solutionCache = cache
+            yaposibTestCheck(prob, ["optimal"], [3.0, -0.5, 7.0],
+                    solve_as_MIP = True)
+            if prob.stats.lpPhase == "cache" or len(cache) != 1:
+                raise yaposib.YaposibError("Result was not stored")
+            again = mip(solver)
+            again.solutionCache = cache
+            yaposibTestCheck(again, ["optimal"], [3.0, -0.5, 7.0],
+                    obj = 64.0, solve_as_MIP = True)
+            if again.stats.lpPhase != "cache" or cache.hits != 1:
+                raise yaposib.YaposibError("Result was not reused")
+            events = again.pollMipEvents()
+            if len(events) != 1 or events[0].kind != "finished" \
+                    or abs(events[0].objective - 64.0) > 1e-6:
+                raise yaposib.YaposibError("Missing 'finished' event")
+            # the solver itself has not solved the model yet
+            again.solutionCache = None
+            again.solve(True)
+            if again.stats.lpPhase != "initialSolve":
+                raise yaposib.YaposibError("Cached model was resolved")
+            # the same model, from the directory
+            again = mip(solver)
+            again.solutionCache = yaposib.SolutionCache(directory = "solutions")
+            again.solve(True)
+            if again.stats.lpPhase != "cache" \
+                    or again.rows[0].name != "c1" \
+                    or abs(again.obj.value - 64.0) > 1e-6:
+                raise yaposib.YaposibError("Result was not read back")
+            # another model
+            again.cols[0].upperbound = 3
+            again.solve(True)
+            if again.stats.lpPhase == "cache":
+                raise yaposib.YaposibError("Wrong result reused")
+            # infeasible results are not stored
+            again.cols[0].lowerbound = 4
+            again.solve(True)
+            again.solve(True)
+            if again.stats.lpPhase == "cache":
+                raise yaposib.YaposibError("Infeasible result reused")
+
+    def test_solverPool(self):
+        for solver in yaposib.available_solvers():
+            yaposib.SolverPool.prewarm(solver, 2)
+            if yaposib.SolverPool.size(solver) != 2:
+                raise yaposib.YaposibError("Pool was not prewarmed")
+            prob = continuous(solver)
+            if yaposib.SolverPool.size(solver) != 1:
+                raise yaposib.YaposibError("Pooled interface not used")
+            yaposibTestCheck(prob, ["optimal"], sol = [4.0, -1.0, 6.0, 0.0])
+            del prob
+            # a reused interface must be empty
+            prob = yaposib.Problem(solver)
+            if len(prob.cols) != 0 or len(prob.rows) != 0:
+                raise yaposib.YaposibError("Pooled interface was not reset")
+            del prob
+            yaposib.SolverPool.setCapacity(0)
+            if yaposib.SolverPool.size(solver) != 0:
+                raise yaposib.YaposibError("Pool was not emptied")
+
+    def test_clear(self):
+        for solver in yaposib.available_solvers():
+            prob = continuous(solver)
+            prob.maxNumIterations = 1000
+            yaposibTestCheck(prob, ["optimal"], sol = [4.0, -1.0, 6.0, 0.0])
+            prob.objOffset = 3.0
+            prob.clear()
+            if len(prob.cols) != 0 or len(prob.rows) != 0:
+                raise yaposib.YaposibError("Problem was not emptied")
+            if prob.maxNumIterations != 1000:
+                raise yaposib.YaposibError("Parameters were not kept")
+            fresh = yaposib.Problem(solver)
+            if prob.obj.name != fresh.obj.name \
+                    or prob.objOffset != fresh.objOffset \
+                    or prob.toMpsBytes() != fresh.toMpsBytes():
+                raise yaposib.YaposibError("Problem differs from a new one")
+            # fill it again with the same model
+            rebuilt = continuous(solver)
+            rebuilt.writeMps("clear")
+            prob.readMps("clear.mps")
+            yaposibTestCheck(prob, ["optimal"], sol = [4.0, -1.0, 6.0, 0.0])
+            prob.clear(keepParams = False)
+            if len(prob.cols) != 0 or prob.obj.maximize:
+                raise yaposib.YaposibError("Problem was not reset")
+
+    def test_solveWithRowGeneration(self):
+        """
+        maximize x + 2y, 0 <= x, y <= 10, the row x + y <= 5 being
+        generated lazily
+        """
+        for solver in yaposib.available_solvers():
+            prob = yaposib.Problem(solver)
+            prob.obj.name = "row_generation"
+            prob.obj.maximize = True
+            for i in range(2):
+                col = prob.cols.add(yaposib.vec([]))
+                col.lowerbound = 0
+                col.upperbound = 10
+            prob.obj[0] = 1
+            prob.obj[1] = 2
+            row = prob.rows.add(yaposib.vec([(0, 1), (1, -1)]))
+            row.upperbound = 100
+            def separator(view):
+                x = view_to_list(view)
+                if x[0] + x[1] > 5:
+                    return ([0, 2], [0, 1], [1.0, 1.0], [-1e30], [5.0])
+                return None
+            rounds = prob.solveWithRowGeneration(separator, maxRounds = 10)
+            if rounds != 2 or len(prob.rows) != 2:
+                raise yaposib.YaposibError("Unexpected rounds: %d" % rounds)
+            yaposibTestCheck(prob, ["optimal"], sol = [0.0, 5.0],
+                    status = prob.status)
+
+    def test_solveWithColumnGeneration(self):
+        """
+        minimize 100 x0 such that x0 >= 1, a cheaper column being priced
+        in lazily
+        """
+        for solver in yaposib.available_solvers():
+            prob = yaposib.Problem(solver)
+            prob.obj.name = "column_generation"
+            col = prob.cols.add(yaposib.vec([]))
+            col.lowerbound = 0
+            prob.obj[0] = 100
+            row = prob.rows.add(yaposib.vec([(0, 1)]))
+            row.lowerbound = 1
+            def pricer(view):
+                duals = view_to_list(view)
+                if duals[0] > 1:
+                    return ([0, 1], [0], [1.0], [0.0], [1e30], [1.0])
+                return None
+            rounds = prob.solveWithColumnGeneration(pricer, maxRounds = 10)
+            if rounds != 2 or len(prob.cols) != 2:
+                raise yaposib.YaposibError("Unexpected rounds: %d" % rounds)
+            yaposibTestCheck(prob, ["optimal"], sol = [0.0, 1.0], obj = 1.0,
+                    status = prob.status)
+
+    def test_benders(self):
+        """
+        minimize x + 2 max(0, 5 - x), 0 <= x <= 10, the second stage
+        being minimize 2y such that y >= 5 - x, y >= 0
+        """
+        for solver in yaposib.available_solvers():
+            master = yaposib.Problem(solver)
+            for i in range(2):
+                col = master.cols.add(yaposib.vec([]))
+                col.lowerbound = 0
+            master.cols[0].upperbound = 10
+            master.obj[0] = 1
+            master.obj[1] = 1
+            sub = yaposib.Problem(solver)
+            col = sub.cols.add(yaposib.vec([]))
+            col.lowerbound = 0
+            sub.obj[0] = 2
+            row = sub.rows.add(yaposib.vec([(0, 1)]))
+            row.lowerbound = 5
+            benders = yaposib.Benders(master)
+            benders.addSubproblem(sub, 1, [0], [0, 1], [0], [1.0])
+            # a second subproblem on the same solver would race with it
+            try:
+                benders.addSubproblem(sub, 1, [0], [0, 1], [0], [1.0])
+            except RuntimeError:
+                pass
+            else:
+                raise yaposib.YaposibError("Benders: shared solver accepted")
+            status = benders.solve(maxIterations = 20)
+            if status != "optimal" or abs(benders.upperBound - 5) > 10**-3:
+                raise yaposib.YaposibError("Benders: %s, %f" %
+                        (status, benders.upperBound))
+            if abs(master.cols[0].solution - 5) > 10**-3:
+                raise yaposib.YaposibError("Benders: wrong first stage")
+
     #--- tests from pulp test suite ---#
 
     def test_continuous(self):